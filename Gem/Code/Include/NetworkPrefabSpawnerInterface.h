@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/span.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 
 namespace MultiplayerSample
@@ -20,6 +21,9 @@ namespace MultiplayerSample
         AZStd::shared_ptr<AzFramework::EntitySpawnTicket>,
         AzFramework::SpawnableConstEntityContainerView)>;
 
+    using PrefabBatchSpawnCallback = AZStd::function<void(
+        const AZStd::vector<AZStd::shared_ptr<AzFramework::EntitySpawnTicket>>&)>;
+
     struct PrefabCallbacks
     {
         PrefabSpawnCallbackBeforeActivation m_beforeActivateCallback;
@@ -54,6 +58,31 @@ namespace MultiplayerSample
          * \param callbacks Optional structure for pre-activate and post-activate callbacks.
          */
         virtual void SpawnDefaultPrefab(const AZ::Transform& worldTm, PrefabCallbacks callbacks) = 0;
+
+        /**
+         * \brief Spawn one instance of a spawnable asset at each of the given transforms.
+         * The asset lookup and the callbacks are shared by the whole batch instead of being set up per instance.
+         * \param worldTms Where to spawn the instances.
+         * \param asset .spawnable asset to spawn from.
+         * \param callbacks Optional structure for pre-activate and post-activate callbacks, called for every instance.
+         * \param onBatchSpawned Optional callback called once all instances are done, with their tickets in the order of worldTms.
+         *        Instances that failed to spawn have a null ticket.
+         */
+        virtual void SpawnPrefabBatch(AZStd::span<const AZ::Transform> worldTms, const AZ::Data::Asset<AzFramework::Spawnable>& asset,
+            PrefabCallbacks callbacks, PrefabBatchSpawnCallback onBatchSpawned) = 0;
+
+        /**
+         * \brief Return an instance created by this spawner, destroying it once no other copy of its ticket is left.
+         * \param ticket The ticket handed out by the spawn callbacks.
+         */
+        virtual void ReleasePrefab(AZStd::shared_ptr<AzFramework::EntitySpawnTicket> ticket) = 0;
+
+        /**
+         * \brief Queue an instance to be released on a later frame, see @ReleasePrefab.
+         * Queued instances are released a few at a time within a per-frame budget so teardown doesn't land in a single frame.
+         * \param ticket The ticket handed out by the spawn callbacks.
+         */
+        virtual void QueueReleasePrefab(AZStd::shared_ptr<AzFramework::EntitySpawnTicket> ticket) = 0;
     };
 
     class NetworkPrefabSpawnerTraits
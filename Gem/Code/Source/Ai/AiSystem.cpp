@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Ai/AiSystem.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(bool, sv_AiParallelTick, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If enabled, AI decisions are spread across the job system");
+    AZ_CVAR(uint32_t, sv_AiAgentsPerJob, 64, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of AI characters ticked by a single job");
+
+    static void OnAiPlaybackFileChanged(const AZ::CVarFixedString& filePath)
+    {
+        if (AiSystem* aiSystem = AZ::Interface<AiSystem>::Get())
+        {
+            aiSystem->LoadPlaybackRecording(filePath.c_str());
+        }
+    }
+    AZ_CVAR(AZ::CVarFixedString, mps_AiPlaybackFile, "", &OnAiPlaybackFileChanged, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If set, AI characters replay the inputs from this recording instead of making random decisions");
+
+    AiSystem::AiSystem()
+    {
+        const AZ::CVarFixedString playbackFile = mps_AiPlaybackFile;
+        LoadPlaybackRecording(playbackFile.c_str());
+    }
+
+    void AiSystem::RegisterMovementController(NetworkAiComponentController& aiController, NetworkPlayerMovementComponentController& movementController)
+    {
+        FindOrAddAgent(aiController).m_movementController = &movementController;
+    }
+
+    void AiSystem::UnregisterMovementController(NetworkAiComponentController& aiController)
+    {
+        auto agentIndex = m_agentIndices.find(&aiController);
+        if (agentIndex != m_agentIndices.end())
+        {
+            m_agents[agentIndex->second].m_movementController = nullptr;
+            RemoveAgentIfUnused(aiController);
+        }
+    }
+
+    void AiSystem::RegisterWeaponsController(NetworkAiComponentController& aiController, NetworkWeaponsComponentController& weaponsController)
+    {
+        FindOrAddAgent(aiController).m_weaponsController = &weaponsController;
+    }
+
+    void AiSystem::UnregisterWeaponsController(NetworkAiComponentController& aiController)
+    {
+        auto agentIndex = m_agentIndices.find(&aiController);
+        if (agentIndex != m_agentIndices.end())
+        {
+            m_agents[agentIndex->second].m_weaponsController = nullptr;
+            RemoveAgentIfUnused(aiController);
+        }
+    }
+
+    void AiSystem::Tick(float deltaTime)
+    {
+        if (GetPlaybackRecording() != nullptr)
+        {
+            // Recorded inputs are applied directly when the controllers create their inputs
+            return;
+        }
+
+        const size_t agentsPerJob = AZ::GetMax<size_t>(sv_AiAgentsPerJob, 1);
+        if (!sv_AiParallelTick || (m_agents.size() <= agentsPerJob))
+        {
+            TickAgents(0, m_agents.size(), deltaTime);
+        }
+        else
+        {
+            // Agents only touch their own state and controllers, so each job can work on a disjoint range
+            AZ::JobCompletion jobCompletion;
+            for (size_t begin = 0; begin < m_agents.size(); begin += agentsPerJob)
+            {
+                const size_t end = AZ::GetMin(begin + agentsPerJob, m_agents.size());
+                AZ::Job* job = AZ::CreateJobFunction([this, begin, end, deltaTime]() { TickAgents(begin, end, deltaTime); }, true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        // Network properties are not thread safe, so the results are written back in a serial pass
+        // Only new directives are stored, the time remaining in a directive is simulated locally
+        for (AiAgent& agent : m_agents)
+        {
+            if (agent.m_directiveChanged)
+            {
+                // Bot clients drive their player from a local state, only the authority owns the replicated one
+                if (agent.m_aiController->IsNetEntityRoleAuthority())
+                {
+                    agent.m_aiController->StoreAiState(agent.m_state);
+                }
+                agent.m_directiveChanged = false;
+            }
+        }
+    }
+
+    void AiSystem::LoadPlaybackRecording(const char* filePath)
+    {
+        m_playbackRecording.Clear();
+        if ((filePath != nullptr) && (filePath[0] != '\0'))
+        {
+            m_playbackRecording.Load(filePath);
+        }
+        ++m_playbackGeneration;
+    }
+
+    const InputRecording* AiSystem::GetPlaybackRecording() const
+    {
+        return m_playbackRecording.IsEmpty() ? nullptr : &m_playbackRecording;
+    }
+
+    uint32_t AiSystem::GetPlaybackGeneration() const
+    {
+        return m_playbackGeneration;
+    }
+
+    AiSystem::AiAgent& AiSystem::FindOrAddAgent(NetworkAiComponentController& aiController)
+    {
+        auto agentIndex = m_agentIndices.find(&aiController);
+        if (agentIndex != m_agentIndices.end())
+        {
+            return m_agents[agentIndex->second];
+        }
+
+        m_agentIndices.emplace(&aiController, m_agents.size());
+        AiAgent& agent = m_agents.emplace_back();
+        agent.m_aiController = &aiController;
+        agent.m_state = aiController.LoadAiState();
+        return agent;
+    }
+
+    void AiSystem::RemoveAgentIfUnused(NetworkAiComponentController& aiController)
+    {
+        auto agentIndex = m_agentIndices.find(&aiController);
+        if (agentIndex == m_agentIndices.end())
+        {
+            return;
+        }
+
+        const size_t index = agentIndex->second;
+        if (m_agents[index].m_movementController != nullptr || m_agents[index].m_weaponsController != nullptr)
+        {
+            return;
+        }
+
+        // Swap the last agent into the freed slot to keep the array contiguous
+        m_agentIndices.erase(agentIndex);
+        if (index != m_agents.size() - 1)
+        {
+            m_agents[index] = AZStd::move(m_agents.back());
+            m_agentIndices[m_agents[index].m_aiController] = index;
+        }
+        m_agents.pop_back();
+    }
+
+    void AiSystem::TickAgents(size_t begin, size_t end, float deltaTime)
+    {
+        for (size_t index = begin; index < end; ++index)
+        {
+            AiAgent& agent = m_agents[index];
+            if (agent.m_movementController != nullptr)
+            {
+                agent.m_directiveChanged |= agent.m_aiController->TickMovement(agent.m_state, *agent.m_movementController, deltaTime);
+            }
+            if (agent.m_weaponsController != nullptr)
+            {
+                agent.m_directiveChanged |= agent.m_aiController->TickWeapons(agent.m_state, *agent.m_weaponsController, deltaTime);
+            }
+        }
+    }
+}
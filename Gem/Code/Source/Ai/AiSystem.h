@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/Ai/AiTypes.h>
+#include <Source/Ai/InputRecording.h>
+#include <Source/Components/NetworkAiComponent.h>
+
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace MultiplayerSample
+{
+    class NetworkPlayerMovementComponentController;
+    class NetworkWeaponsComponentController;
+
+    //! @class AiSystem
+    //! @brief Ticks every AI character in a single batched pass.
+    //!
+    //! AI driven movement and weapons controllers register here instead of scheduling their own update events.
+    //! The decision state of every AI character is kept in one contiguous array, all movement and weapon decisions
+    //! are made in one pass which can optionally be spread across the job system, and the resulting state is then
+    //! written back to the NetworkAiComponentControllers whenever a character picks a new directive. Each character
+    //! owns its random number generator, so results are deterministic per seed regardless of tick order or parallelism.
+    //!
+    //! If a playback recording is loaded, AI characters replay recorded player inputs instead of making random decisions.
+    class AiSystem
+    {
+    public:
+        AZ_RTTI(AiSystem, "{3B1D6E5A-8C2F-4B7E-A0D4-6F9E2C1B7A35}");
+        AiSystem();
+        virtual ~AiSystem() = default;
+
+        void RegisterMovementController(NetworkAiComponentController& aiController, NetworkPlayerMovementComponentController& movementController);
+        void UnregisterMovementController(NetworkAiComponentController& aiController);
+
+        void RegisterWeaponsController(NetworkAiComponentController& aiController, NetworkWeaponsComponentController& weaponsController);
+        void UnregisterWeaponsController(NetworkAiComponentController& aiController);
+
+        //! Runs all AI decisions for this tick.
+        //! @param deltaTime the time in seconds since the last tick
+        void Tick(float deltaTime);
+
+        //! Loads the recording AI characters replay instead of making random decisions.
+        //! @param filePath the recording to load, an empty path returns AI characters to random decisions
+        void LoadPlaybackRecording(const char* filePath);
+
+        //! Returns the recording AI characters replay, or nullptr if they make random decisions.
+        const InputRecording* GetPlaybackRecording() const;
+
+        //! Returns a counter incremented every time the playback recording is loaded or cleared.
+        //! Characters compare it with the value they started playback with to know when to start over.
+        uint32_t GetPlaybackGeneration() const;
+
+    private:
+        struct AiAgent
+        {
+            NetworkAiComponentController* m_aiController = nullptr;
+            NetworkPlayerMovementComponentController* m_movementController = nullptr;
+            NetworkWeaponsComponentController* m_weaponsController = nullptr;
+            AiState m_state;
+            bool m_directiveChanged = false;
+        };
+
+        AiAgent& FindOrAddAgent(NetworkAiComponentController& aiController);
+        void RemoveAgentIfUnused(NetworkAiComponentController& aiController);
+        void TickAgents(size_t begin, size_t end, float deltaTime);
+
+        AZStd::vector<AiAgent> m_agents;
+        AZStd::unordered_map<const NetworkAiComponentController*, size_t> m_agentIndices;
+        InputRecording m_playbackRecording;
+        uint32_t m_playbackGeneration = 0;
+    };
+}
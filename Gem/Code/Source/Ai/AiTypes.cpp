@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Ai/AiTypes.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace MultiplayerSample
+{
+    constexpr uint64_t LcgStateMask = (1ULL << 48) - 1;
+
+    void AiState::SetSeed(uint64_t seed)
+    {
+        // Reimplements SimpleLcgRandom's seeding so the generator state can be replicated
+        m_randomState = (seed ^ 0x5DEECE66DULL) & LcgStateMask;
+    }
+
+    uint32_t AiState::GetRandom()
+    {
+        // Reimplements SimpleLcgRandom's rand int so the generator state can be replicated
+        m_randomState = (m_randomState * 0x5DEECE66DULL + 0xBULL) & LcgStateMask;
+        return static_cast<uint32_t>(m_randomState >> 16);
+    }
+
+    float AiState::GetRandomFloat()
+    {
+        // Reimplements SimpleLcgRandom's rand float so the generator state can be replicated
+        uint32_t r = GetRandom();
+        r &= 0x007fffff; //sets mantissa to random bits
+        r |= 0x3f800000; //result is in [1,2), uniformly distributed
+        union
+        {
+            float f;
+            uint32_t i;
+        } u;
+        u.i = r;
+        return u.f - 1.0f;
+    }
+
+    bool AiState::operator!=(const AiState& rhs) const
+    {
+        return m_randomState != rhs.m_randomState
+            || !AZ::IsClose(m_directiveDurationMs, rhs.m_directiveDurationMs)
+            || m_targetYawDelta != rhs.m_targetYawDelta
+            || m_targetPitchDelta != rhs.m_targetPitchDelta
+            || !AZ::IsClose(m_timeToNextShot, rhs.m_timeToNextShot)
+            || m_action != rhs.m_action
+            || m_strafingRight != rhs.m_strafingRight
+            || m_shotFired != rhs.m_shotFired;
+    }
+
+    bool AiState::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        const bool result = serializer.Serialize(m_randomState, "RandomState")
+            && serializer.Serialize(m_directiveDurationMs, "DirectiveDurationMs")
+            && serializer.Serialize(m_targetYawDelta, "TargetYawDelta")
+            && serializer.Serialize(m_targetPitchDelta, "TargetPitchDelta")
+            && serializer.Serialize(m_timeToNextShot, "TimeToNextShot")
+            && serializer.Serialize(m_action, "Action")
+            && serializer.Serialize(m_strafingRight, "StrafingRight")
+            && serializer.Serialize(m_shotFired, "ShotFired");
+
+        // The state is only sent when a directive is chosen, so the directive restarts on the receiving host
+        if (result && serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
+        {
+            m_remainingTimeMs = m_directiveDurationMs;
+            m_turnRate = (m_directiveDurationMs > 0.f) ? 1.f / m_directiveDurationMs : 0.f;
+        }
+        return result;
+    }
+}
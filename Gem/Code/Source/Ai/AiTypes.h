@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/MultiplayerSampleTypes.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace MultiplayerSample
+{
+    using AiYawDelta = AzNetworking::QuantizedValues<1, 2, -2, 2>;
+    using AiPitchDelta = AzNetworking::QuantizedValues<1, 2, -1, 1>;
+
+    //! Decision state of a single AI character.
+    //! The AiSystem ticks one of these per AI character every frame, but it is only replicated when a new movement or
+    //! weapons directive is chosen. The random number generator state travels with it, so a migrated AI character
+    //! keeps rolling the same sequence of decisions.
+    struct AiState
+    {
+        uint64_t m_randomState = 0;          // State of the 48 bit linear congruential generator used for all decisions
+        float m_directiveDurationMs = 0.f;   // Duration of the current movement directive
+        float m_remainingTimeMs = 0.f;       // Time left before a new movement directive is chosen, not replicated
+        float m_turnRate = 0.f;              // Fraction of the target view deltas to apply per ms, derived from the directive duration
+        AiYawDelta m_targetYawDelta;         // View yaw change to apply over the current directive
+        AiPitchDelta m_targetPitchDelta;     // View pitch change to apply over the current directive
+        float m_timeToNextShot = 0.f;        // Time left before the weapons directive changes
+        Action m_action = Action::Default;   // Movement action of the current directive
+        bool m_strafingRight = false;        // Strafe direction, only used by the Strafing action
+        bool m_shotFired = true;             // Whether the current weapons directive fired
+        Multiplayer::NetEntityId m_targetNetEntityId = Multiplayer::InvalidNetEntityId; // Character being aimed at, not replicated
+
+        //! Seeds the generator, producing the same sequence as AZ::SimpleLcgRandom for the same seed.
+        void SetSeed(uint64_t seed);
+        uint32_t GetRandom();
+        float GetRandomFloat();
+
+        bool operator!=(const AiState& rhs) const;
+        bool Serialize(AzNetworking::ISerializer& serializer);
+    };
+}
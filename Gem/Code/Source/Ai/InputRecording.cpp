@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Ai/InputRecording.h>
+#include <Source/Components/NetworkPlayerMovementComponent.h>
+#include <Source/Components/NetworkWeaponsComponent.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(AZ::CVarFixedString, mps_InputRecordFile, "@user@/InputRecording.mpinput", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The default file written by mps_InputRecordStart");
+
+    static void mps_InputRecordStart(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (InputRecorder* recorder = AZ::Interface<InputRecorder>::Get())
+        {
+            const AZ::CVarFixedString filePath = arguments.empty() ? static_cast<AZ::CVarFixedString>(mps_InputRecordFile) : AZ::CVarFixedString(arguments.front());
+            recorder->StartRecording(filePath.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mps_InputRecordStart, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Starts recording the inputs of the local player, optional argument is the output file");
+
+    static void mps_InputRecordStop([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (InputRecorder* recorder = AZ::Interface<InputRecorder>::Get())
+        {
+            recorder->StopRecording();
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mps_InputRecordStop, AZ::ConsoleFunctorFlags::DontReplicate, "Stops recording inputs and writes the recording file");
+
+    constexpr uint32_t InputRecordingMagic = 0x5249504D; // "MPIR"
+    constexpr uint32_t InputRecordingVersion = 1;
+    constexpr uint32_t InputRecordingHeaderSize = 32;
+    constexpr uint32_t MaxSerializedFrameSize = 16;
+
+    enum RecordedInputFlags : uint8_t
+    {
+        Sprint = 1 << 0,
+        Jump = 1 << 1,
+        Crouch = 1 << 2,
+        Draw = 1 << 3,
+    };
+
+    bool RecordedInputFrame::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        // Pack the buttons into a single byte to keep recordings small
+        uint8_t flags = (m_sprint ? Sprint : 0) | (m_jump ? Jump : 0) | (m_crouch ? Crouch : 0) | (m_draw ? Draw : 0);
+
+        const bool result = serializer.Serialize(m_forwardAxis, "ForwardAxis")
+            && serializer.Serialize(m_strafeAxis, "StrafeAxis")
+            && serializer.Serialize(m_viewYaw, "ViewYaw")
+            && serializer.Serialize(m_viewPitch, "ViewPitch")
+            && serializer.Serialize(m_firing, "Firing")
+            && serializer.Serialize(flags, "Flags");
+
+        m_sprint = (flags & Sprint) != 0;
+        m_jump = (flags & Jump) != 0;
+        m_crouch = (flags & Crouch) != 0;
+        m_draw = (flags & Draw) != 0;
+        return result;
+    }
+
+    bool InputRecording::Load(const char* filePath)
+    {
+        Clear();
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        if ((fileIO == nullptr) || !fileIO->Open(filePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, fileHandle))
+        {
+            AZLOG_ERROR("Failed to open input recording %s", filePath);
+            return false;
+        }
+
+        AZ::u64 fileSize = 0;
+        fileIO->Size(fileHandle, fileSize);
+        AZStd::vector<uint8_t> buffer(fileSize);
+        const bool readResult = fileIO->Read(fileHandle, buffer.data(), buffer.size(), true);
+        fileIO->Close(fileHandle);
+        if (!readResult)
+        {
+            AZLOG_ERROR("Failed to read input recording %s", filePath);
+            return false;
+        }
+
+        AzNetworking::NetworkOutputSerializer serializer(buffer.data(), aznumeric_cast<uint32_t>(buffer.size()));
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        int64_t inputRateMs = 0;
+        uint32_t frameCount = 0;
+        serializer.Serialize(magic, "Magic");
+        serializer.Serialize(version, "Version");
+        serializer.Serialize(inputRateMs, "InputRateMs");
+        serializer.Serialize(frameCount, "FrameCount");
+        if (!serializer.IsValid() || (magic != InputRecordingMagic) || (version != InputRecordingVersion))
+        {
+            AZLOG_ERROR("%s is not a supported input recording", filePath);
+            return false;
+        }
+
+        // Every frame serializes at least its flags byte, so a count larger than the file comes from a corrupt header
+        if (frameCount > buffer.size())
+        {
+            AZLOG_ERROR("Input recording %s claims %u frames but only has %llu bytes", filePath, frameCount,
+                static_cast<unsigned long long>(buffer.size()));
+            return false;
+        }
+
+        m_inputRateMs = static_cast<AZ::TimeMs>(inputRateMs);
+        m_frames.reserve(frameCount);
+        for (uint32_t frameIndex = 0; frameIndex < frameCount; ++frameIndex)
+        {
+            RecordedInputFrame frame;
+            if (!frame.Serialize(serializer))
+            {
+                AZLOG_ERROR("Input recording %s is truncated", filePath);
+                Clear();
+                return false;
+            }
+            m_frames.push_back(frame);
+        }
+
+        AZLOG_INFO("Loaded input recording %s with %u frames", filePath, frameCount);
+        return true;
+    }
+
+    bool InputRecording::Save(const char* filePath) const
+    {
+        AZStd::vector<uint8_t> buffer(InputRecordingHeaderSize + m_frames.size() * MaxSerializedFrameSize);
+        AzNetworking::NetworkInputSerializer serializer(buffer.data(), aznumeric_cast<uint32_t>(buffer.size()));
+
+        uint32_t magic = InputRecordingMagic;
+        uint32_t version = InputRecordingVersion;
+        int64_t inputRateMs = static_cast<int64_t>(m_inputRateMs);
+        uint32_t frameCount = GetFrameCount();
+        serializer.Serialize(magic, "Magic");
+        serializer.Serialize(version, "Version");
+        serializer.Serialize(inputRateMs, "InputRateMs");
+        serializer.Serialize(frameCount, "FrameCount");
+        for (RecordedInputFrame frame : m_frames)
+        {
+            frame.Serialize(serializer);
+        }
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        if (!serializer.IsValid() || (fileIO == nullptr)
+            || !fileIO->Open(filePath, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle))
+        {
+            AZLOG_ERROR("Failed to write input recording %s", filePath);
+            return false;
+        }
+
+        fileIO->Write(fileHandle, buffer.data(), serializer.GetSize());
+        fileIO->Close(fileHandle);
+        return true;
+    }
+
+    void InputRecording::Clear()
+    {
+        m_frames.clear();
+    }
+
+    bool InputRecording::IsEmpty() const
+    {
+        return m_frames.empty();
+    }
+
+    uint32_t InputRecording::GetFrameCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_frames.size());
+    }
+
+    AZ::TimeMs InputRecording::GetInputRateMs() const
+    {
+        return m_inputRateMs;
+    }
+
+    void InputRecording::SetInputRateMs(AZ::TimeMs inputRateMs)
+    {
+        m_inputRateMs = inputRateMs;
+    }
+
+    const RecordedInputFrame& InputRecording::GetFrame(uint32_t frameIndex) const
+    {
+        return m_frames[frameIndex];
+    }
+
+    RecordedInputFrame& InputRecording::ModifyFrame(uint32_t frameIndex)
+    {
+        if (frameIndex >= m_frames.size())
+        {
+            m_frames.resize(frameIndex + 1);
+        }
+        return m_frames[frameIndex];
+    }
+
+    InputRecorder::~InputRecorder()
+    {
+        StopRecording();
+    }
+
+    void InputRecorder::StartRecording(const char* filePath)
+    {
+        m_recording.Clear();
+        m_filePath = filePath;
+        m_movementFrameCount = 0;
+        m_weaponsFrameCount = 0;
+        m_isRecording = true;
+
+        AZ::TimeMs inputRateMs = AZ::TimeMs{ 33 };
+        AZ::Interface<AZ::IConsole>::Get()->GetCvarValue("cl_InputRateMs", inputRateMs);
+        m_recording.SetInputRateMs(inputRateMs);
+        AZLOG_INFO("Started recording inputs to %s", filePath);
+    }
+
+    void InputRecorder::StopRecording()
+    {
+        if (!m_isRecording)
+        {
+            return;
+        }
+
+        m_isRecording = false;
+        if (m_recording.Save(m_filePath.c_str()))
+        {
+            AZLOG_INFO("Saved %u input frames to %s", m_recording.GetFrameCount(), m_filePath.c_str());
+        }
+        m_recording.Clear();
+    }
+
+    bool InputRecorder::IsRecording() const
+    {
+        return m_isRecording;
+    }
+
+    void InputRecorder::RecordMovementInput(const NetworkPlayerMovementComponentNetworkInput& movementInput)
+    {
+        RecordedInputFrame& frame = m_recording.ModifyFrame(m_movementFrameCount++);
+        frame.m_forwardAxis = movementInput.m_forwardAxis;
+        frame.m_strafeAxis = movementInput.m_strafeAxis;
+        frame.m_viewYaw = movementInput.m_viewYaw;
+        frame.m_viewPitch = movementInput.m_viewPitch;
+        frame.m_sprint = movementInput.m_sprint;
+        frame.m_jump = movementInput.m_jump;
+        frame.m_crouch = movementInput.m_crouch;
+    }
+
+    void InputRecorder::RecordWeaponsInput(const NetworkWeaponsComponentNetworkInput& weaponsInput)
+    {
+        RecordedInputFrame& frame = m_recording.ModifyFrame(m_weaponsFrameCount++);
+        frame.m_draw = weaponsInput.m_draw;
+        frame.m_firing = weaponsInput.m_firing;
+    }
+}
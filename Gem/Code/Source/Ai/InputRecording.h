@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/MultiplayerSampleTypes.h>
+#include <Source/Weapons/WeaponTypes.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace MultiplayerSample
+{
+    class NetworkPlayerMovementComponentNetworkInput;
+    class NetworkWeaponsComponentNetworkInput;
+
+    //! The movement and weapons inputs a player submitted for one input frame.
+    //! The shot start position is not recorded, it is recomputed from the fire bone when played back.
+    struct RecordedInputFrame
+    {
+        StickAxis m_forwardAxis{ 0.0f };
+        StickAxis m_strafeAxis{ 0.0f };
+        MouseAxis m_viewYaw{ 0.0f };
+        MouseAxis m_viewPitch{ 0.0f };
+        WeaponActivationBitset m_firing;
+        bool m_sprint = false;
+        bool m_jump = false;
+        bool m_crouch = false;
+        bool m_draw = false;
+
+        bool Serialize(AzNetworking::ISerializer& serializer);
+    };
+
+    //! @class InputRecording
+    //! @brief A stream of input frames recorded from a real player, stored in a compact binary file.
+    class InputRecording
+    {
+    public:
+        bool Load(const char* filePath);
+        bool Save(const char* filePath) const;
+
+        void Clear();
+        bool IsEmpty() const;
+        uint32_t GetFrameCount() const;
+
+        //! Returns the input rate the recording was captured at, used to convert times to frame counts.
+        AZ::TimeMs GetInputRateMs() const;
+        void SetInputRateMs(AZ::TimeMs inputRateMs);
+
+        const RecordedInputFrame& GetFrame(uint32_t frameIndex) const;
+
+        //! Returns the frame at the provided index, adding frames if needed.
+        //! Movement and weapons inputs are created separately, so each fills in its own half of the frame.
+        RecordedInputFrame& ModifyFrame(uint32_t frameIndex);
+
+    private:
+        AZStd::vector<RecordedInputFrame> m_frames;
+        AZ::TimeMs m_inputRateMs = AZ::TimeMs{ 33 };
+    };
+
+    //! @class InputRecorder
+    //! @brief Records the inputs of the local player so they can be replayed by AI characters.
+    //!
+    //! Recording is controlled with the mps_InputRecordStart and mps_InputRecordStop console commands.
+    class InputRecorder
+    {
+    public:
+        AZ_RTTI(InputRecorder, "{6A0F3E8D-2B7C-4D91-8E45-B3C1F7A92D06}");
+        virtual ~InputRecorder();
+
+        //! Starts recording, discarding anything recorded so far.
+        //! @param filePath the file written when the recording stops, file IO aliases such as @user@ are supported
+        void StartRecording(const char* filePath);
+
+        //! Stops recording and writes the recorded frames to the file.
+        void StopRecording();
+
+        bool IsRecording() const;
+
+        void RecordMovementInput(const NetworkPlayerMovementComponentNetworkInput& movementInput);
+        void RecordWeaponsInput(const NetworkWeaponsComponentNetworkInput& weaponsInput);
+
+    private:
+        InputRecording m_recording;
+        AZStd::string m_filePath;
+        uint32_t m_movementFrameCount = 0;
+        uint32_t m_weaponsFrameCount = 0;
+        bool m_isRecording = false;
+    };
+}
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Animation/AnimationUpdateScheduler.h>
+
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzFramework/Components/CameraBus.h>
+#include <Integration/AnimGraphNetworkingBus.h>
+#include <Multiplayer/IMultiplayer.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(bool, cl_AnimLodEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If enabled, distant and off-screen characters update their animation at reduced rates");
+    AZ_CVAR(float, cl_AnimLodNearDistance, 15.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Characters closer to the camera than this distance update their animation every frame");
+    AZ_CVAR(float, cl_AnimLodFarDistance, 40.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Characters further from the camera than this distance update their animation at the far rate");
+    AZ_CVAR(float, cl_AnimLodMidRateHz, 20.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Animation update rate for visible characters between the near and far distances");
+    AZ_CVAR(float, cl_AnimLodFarRateHz, 10.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Animation update rate for visible characters beyond the far distance");
+    AZ_CVAR(float, cl_AnimLodOffscreenRateHz, 5.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Animation update rate for characters outside of the camera view");
+    AZ_CVAR(uint32_t, cl_AnimLodMaxThrottledUpdatesPerFrame, 32, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum number of reduced rate animation updates per frame, 0 for unlimited");
+    AZ_CVAR(bool, sv_AnimLodEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If enabled, dedicated servers only update animation every frame for characters using their weapons");
+    AZ_CVAR(float, sv_AnimLodIdleRateHz, 10.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Animation update rate on dedicated servers for characters not using their weapons");
+    AZ_CVAR(uint32_t, sv_AnimLodMaxThrottledUpdatesPerFrame, 64, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum number of reduced rate animation updates per frame on dedicated servers, 0 for unlimited");
+    AZ_CVAR(float, sv_AnimLodWeaponRange, 100.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Authoritative characters within this distance of a character using its weapon animate every frame, so their hit volumes are current when shots are validated");
+    AZ_CVAR(bool, mps_AnimBatchParallel, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If enabled, queued actor updates are spread across the job system");
+    AZ_CVAR(uint32_t, mps_AnimBatchActorsPerJob, 8, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of actors updated by a single animation job");
+
+    static void mps_AnimBatchBenchmark(const AZ::ConsoleCommandContainer& arguments)
+    {
+        AnimationUpdateScheduler* scheduler = AZ::Interface<AnimationUpdateScheduler>::Get();
+        if (scheduler == nullptr)
+        {
+            return;
+        }
+
+        uint32_t frameCount = 100;
+        if (!arguments.empty())
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(frameCount, arguments.front());
+        }
+        scheduler->Benchmark(AZ::GetMax(frameCount, 1u));
+    }
+    AZ_CONSOLEFREEFUNC(mps_AnimBatchBenchmark, AZ::ConsoleFunctorFlags::Null,
+        "Times serial and parallel updates of all registered character actors, optional argument is the number of frames to simulate");
+
+    // Extra half-angle added to the camera view cone so characters at the edge of the screen are never treated as off-screen
+    constexpr float OffscreenAngleMargin = AZ::DegToRad(10.0f);
+
+    void AnimationUpdateScheduler::BeginFrame()
+    {
+        m_throttledUpdatesThisFrame = 0;
+
+        // When more actors were due than the budget admits, only the most overdue ones are admitted next frame.
+        // Actors that miss out keep growing overdue, so every actor is eventually admitted.
+        const uint32_t maxThrottledUpdates = GetMaxThrottledUpdatesPerFrame();
+        m_minAdmittedOverdue = 0.0f;
+        if ((maxThrottledUpdates > 0) && (m_dueOverdueRatios.size() > maxThrottledUpdates))
+        {
+            auto nth = m_dueOverdueRatios.begin() + (maxThrottledUpdates - 1);
+            AZStd::nth_element(m_dueOverdueRatios.begin(), nth, m_dueOverdueRatios.end(), AZStd::greater<float>());
+            m_minAdmittedOverdue = *nth;
+        }
+        m_dueOverdueRatios.clear();
+
+        // Weapons used during the frame that just ended keep the characters around them at full rate
+        m_weaponPositions.swap(m_pendingWeaponPositions);
+        m_pendingWeaponPositions.clear();
+
+        const Multiplayer::IMultiplayer* multiplayer = AZ::Interface<Multiplayer::IMultiplayer>::Get();
+        m_isDedicatedServer = (multiplayer != nullptr)
+            && (multiplayer->GetAgentType() == Multiplayer::MultiplayerAgentType::DedicatedServer);
+        if (m_isDedicatedServer)
+        {
+            m_hasView = false;
+            return;
+        }
+
+        AZ::Transform cameraTm = AZ::Transform::CreateIdentity();
+        Camera::Configuration cameraConfig;
+        m_hasView = Camera::ActiveCameraRequestBus::HasHandlers();
+        Camera::ActiveCameraRequestBus::BroadcastResult(cameraTm, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+        Camera::ActiveCameraRequestBus::BroadcastResult(cameraConfig, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraConfiguration);
+
+        m_viewPosition = cameraTm.GetTranslation();
+        m_viewForward = cameraTm.GetBasisY().GetNormalizedSafe();
+
+        // Treat the view as a cone wide enough to contain the horizontal extents of the frustum
+        const float aspectRatio = (cameraConfig.m_frustumHeight > 0.0f) ? cameraConfig.m_frustumWidth / cameraConfig.m_frustumHeight : 1.0f;
+        const float horizontalHalfFov = AZ::Atan(AZ::Tan(cameraConfig.m_fovRadians * 0.5f) * AZ::GetMax(aspectRatio, 1.0f));
+        const float coneHalfAngle = horizontalHalfFov + OffscreenAngleMargin;
+        m_minVisibleDot = (coneHalfAngle >= AZ::Constants::Pi) ? -1.0f : AZ::Cos(coneHalfAngle);
+    }
+
+    bool AnimationUpdateScheduler::ShouldUpdate(const AZ::Vector3& worldPosition, bool forceUpdate, float timeSinceLastUpdate)
+    {
+        if (forceUpdate)
+        {
+            return true;
+        }
+
+        const float updateInterval = GetUpdateInterval(worldPosition);
+        if (updateInterval <= 0.0f)
+        {
+            return true;
+        }
+
+        if (timeSinceLastUpdate < updateInterval)
+        {
+            return false;
+        }
+
+        // Throttled actors that miss the budget keep accumulating time and get picked up on a following frame
+        const float overdueRatio = timeSinceLastUpdate / updateInterval;
+        m_dueOverdueRatios.push_back(overdueRatio);
+        const uint32_t maxThrottledUpdates = GetMaxThrottledUpdatesPerFrame();
+        if ((maxThrottledUpdates > 0)
+            && ((overdueRatio < m_minAdmittedOverdue) || (m_throttledUpdatesThisFrame >= maxThrottledUpdates)))
+        {
+            return false;
+        }
+
+        ++m_throttledUpdatesThisFrame;
+        return true;
+    }
+
+    void AnimationUpdateScheduler::ReportWeaponInUse(const AZ::Vector3& worldPosition)
+    {
+        m_pendingWeaponPositions.push_back(worldPosition);
+    }
+
+    bool AnimationUpdateScheduler::IsInWeaponRange(const AZ::Vector3& worldPosition) const
+    {
+        const float weaponRangeSq = sv_AnimLodWeaponRange * sv_AnimLodWeaponRange;
+        for (const AZ::Vector3& weaponPosition : m_weaponPositions)
+        {
+            if (weaponPosition.GetDistanceSq(worldPosition) <= weaponRangeSq)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t AnimationUpdateScheduler::GetMaxThrottledUpdatesPerFrame() const
+    {
+        return m_isDedicatedServer ? static_cast<uint32_t>(sv_AnimLodMaxThrottledUpdatesPerFrame)
+                                   : static_cast<uint32_t>(cl_AnimLodMaxThrottledUpdatesPerFrame);
+    }
+
+    float AnimationUpdateScheduler::GetUpdateInterval(const AZ::Vector3& worldPosition) const
+    {
+        if (m_isDedicatedServer)
+        {
+            return (sv_AnimLodEnabled && sv_AnimLodIdleRateHz > 0.0f) ? 1.0f / sv_AnimLodIdleRateHz : 0.0f;
+        }
+
+        if (!cl_AnimLodEnabled || !m_hasView)
+        {
+            return 0.0f;
+        }
+
+        const AZ::Vector3 toCharacter = worldPosition - m_viewPosition;
+        const float distanceSq = toCharacter.GetLengthSq();
+        const float nearDistance = cl_AnimLodNearDistance;
+        if (distanceSq <= nearDistance * nearDistance)
+        {
+            return 0.0f;
+        }
+
+        float rateHz = cl_AnimLodMidRateHz;
+        if (m_viewForward.Dot(toCharacter) < m_minVisibleDot * AZ::Sqrt(distanceSq))
+        {
+            rateHz = cl_AnimLodOffscreenRateHz;
+        }
+        else
+        {
+            const float farDistance = cl_AnimLodFarDistance;
+            if (distanceSq > farDistance * farDistance)
+            {
+                rateHz = cl_AnimLodFarRateHz;
+            }
+        }
+
+        return (rateHz > 0.0f) ? 1.0f / rateHz : 0.0f;
+    }
+
+    void AnimationUpdateScheduler::RegisterActor(EMotionFX::AnimGraphComponentNetworkRequests* actor)
+    {
+        if (AZStd::find(m_registeredActors.begin(), m_registeredActors.end(), actor) == m_registeredActors.end())
+        {
+            m_registeredActors.push_back(actor);
+        }
+    }
+
+    void AnimationUpdateScheduler::UnregisterActor(EMotionFX::AnimGraphComponentNetworkRequests* actor)
+    {
+        m_registeredActors.erase(AZStd::remove(m_registeredActors.begin(), m_registeredActors.end(), actor), m_registeredActors.end());
+        m_pendingUpdates.erase(AZStd::remove_if(m_pendingUpdates.begin(), m_pendingUpdates.end(),
+            [actor](const PendingUpdate& pendingUpdate) { return pendingUpdate.m_actor == actor; }), m_pendingUpdates.end());
+    }
+
+    void AnimationUpdateScheduler::QueueActorUpdate(EMotionFX::AnimGraphComponentNetworkRequests* actor, float deltaTime)
+    {
+        m_pendingUpdates.push_back({ actor, deltaTime });
+    }
+
+    void AnimationUpdateScheduler::UpdateActors()
+    {
+        RunUpdates(m_pendingUpdates, mps_AnimBatchParallel);
+        m_pendingUpdates.clear();
+    }
+
+    void AnimationUpdateScheduler::Benchmark(uint32_t frameCount)
+    {
+        constexpr float BenchmarkDeltaTime = 1.0f / 60.0f;
+
+        PendingUpdates updates;
+        updates.reserve(m_registeredActors.size());
+        for (EMotionFX::AnimGraphComponentNetworkRequests* actor : m_registeredActors)
+        {
+            updates.push_back({ actor, BenchmarkDeltaTime });
+        }
+
+        auto timeUpdates = [this, &updates, frameCount](bool allowParallel)
+        {
+            const AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
+            for (uint32_t frame = 0; frame < frameCount; ++frame)
+            {
+                RunUpdates(updates, allowParallel);
+            }
+            const AZStd::chrono::duration<double, AZStd::milli> elapsed = AZStd::chrono::steady_clock::now() - start;
+            return elapsed.count() / frameCount;
+        };
+
+        const double serialMs = timeUpdates(false);
+        const double parallelMs = timeUpdates(true);
+        AZLOG_INFO("Animation batch benchmark: %zu actors, %u frames, serial %.3f ms/frame, parallel %.3f ms/frame (%.2fx) across %u worker threads",
+            updates.size(), frameCount, serialMs, parallelMs, (parallelMs > 0.0) ? serialMs / parallelMs : 0.0,
+            AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads());
+    }
+
+    void AnimationUpdateScheduler::RunUpdates(const PendingUpdates& updates, bool allowParallel) const
+    {
+        const size_t actorsPerJob = AZ::GetMax<size_t>(mps_AnimBatchActorsPerJob, 1);
+        if (!allowParallel || (updates.size() <= actorsPerJob))
+        {
+            for (const PendingUpdate& update : updates)
+            {
+                update.m_actor->UpdateActorExternal(update.m_deltaTime);
+            }
+            return;
+        }
+
+        // Each actor instance is only touched by a single job, and nothing reads the poses until the completion is signaled
+        AZ::JobCompletion jobCompletion;
+        for (size_t begin = 0; begin < updates.size(); begin += actorsPerJob)
+        {
+            const size_t end = AZ::GetMin(begin + actorsPerJob, updates.size());
+            AZ::Job* job = AZ::CreateJobFunction([&updates, begin, end]()
+            {
+                for (size_t index = begin; index < end; ++index)
+                {
+                    updates[index].m_actor->UpdateActorExternal(updates[index].m_deltaTime);
+                }
+            }, true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class AnimGraphComponentNetworkRequests;
+}
+
+namespace MultiplayerSample
+{
+    //! @class AnimationUpdateScheduler
+    //! @brief Decides how often each networked character's actor gets updated, and performs those updates as one batch.
+    //!
+    //! Characters close to the active camera update every frame, distant or off-screen simulated proxies
+    //! update at reduced rates with their skipped time accumulated, and all throttled updates share a
+    //! per-frame budget that goes to the most overdue actors first. Dedicated servers have no camera, so idle
+    //! characters update at a low fixed rate under their own budget, and characters using their weapons or
+    //! within weapon range of one are updated every frame.
+    //!
+    //! Animation components register their actors, stage their anim graph parameters during pre-render and
+    //! queue an update. The queued actors are then updated together across the job system once per frame,
+    //! with a single sync point before rendering reads the poses.
+    class AnimationUpdateScheduler
+    {
+    public:
+        AZ_RTTI(AnimationUpdateScheduler, "{5E0C6D0B-3F4E-4A53-9C74-2B1C2D8E1F6A}");
+        virtual ~AnimationUpdateScheduler() = default;
+
+        //! Resets the per-frame budget and caches the view used for distance and visibility tests.
+        //! Called once per frame by the MultiplayerSampleSystemComponent.
+        void BeginFrame();
+
+        //! Returns true if an actor should be updated this frame.
+        //! @param worldPosition the world position of the character
+        //! @param forceUpdate true if the character must be updated every frame (local autonomous player, weapons in use)
+        //! @param timeSinceLastUpdate the time in seconds accumulated since this actor was last updated
+        bool ShouldUpdate(const AZ::Vector3& worldPosition, bool forceUpdate, float timeSinceLastUpdate);
+
+        //! Records that an authoritative character used its weapon this frame.
+        //! Characters in weapon range of it animate every frame during the next frame, see IsInWeaponRange.
+        void ReportWeaponInUse(const AZ::Vector3& worldPosition);
+
+        //! Returns true if a character used its weapon within sv_AnimLodWeaponRange of worldPosition during the previous frame.
+        bool IsInWeaponRange(const AZ::Vector3& worldPosition) const;
+
+        //! Adds an actor to the set of actors updated by this scheduler.
+        void RegisterActor(EMotionFX::AnimGraphComponentNetworkRequests* actor);
+
+        //! Removes an actor from this scheduler, including any update still queued for it.
+        void UnregisterActor(EMotionFX::AnimGraphComponentNetworkRequests* actor);
+
+        //! Queues a registered actor to be advanced by deltaTime on the next call to UpdateActors.
+        //! Anim graph parameters must be written before queueing, they are not safe to modify during the batch.
+        void QueueActorUpdate(EMotionFX::AnimGraphComponentNetworkRequests* actor, float deltaTime);
+
+        //! Updates all queued actors, fanning the work out across the job system, and waits for completion.
+        void UpdateActors();
+
+        //! Times serial and parallel updates of every registered actor and logs the results.
+        //! @param frameCount the number of frames to simulate for each mode
+        void Benchmark(uint32_t frameCount);
+
+    private:
+        struct PendingUpdate
+        {
+            EMotionFX::AnimGraphComponentNetworkRequests* m_actor = nullptr;
+            float m_deltaTime = 0.0f;
+        };
+        using PendingUpdates = AZStd::vector<PendingUpdate>;
+
+        float GetUpdateInterval(const AZ::Vector3& worldPosition) const;
+        uint32_t GetMaxThrottledUpdatesPerFrame() const;
+        void RunUpdates(const PendingUpdates& updates, bool allowParallel) const;
+
+        AZStd::vector<EMotionFX::AnimGraphComponentNetworkRequests*> m_registeredActors;
+        PendingUpdates m_pendingUpdates;
+
+        AZ::Vector3 m_viewPosition = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_viewForward = AZ::Vector3::CreateAxisY();
+        float m_minVisibleDot = -1.0f;
+        bool m_hasView = false;
+        bool m_isDedicatedServer = false;
+        uint32_t m_throttledUpdatesThisFrame = 0;
+
+        //! How overdue each actor due for a throttled update was this frame, as a multiple of its update interval
+        AZStd::vector<float> m_dueOverdueRatios;
+        //! Actors less overdue than this are not admitted, so the budget goes to the actors that waited longest
+        float m_minAdmittedOverdue = 0.0f;
+
+        AZStd::vector<AZ::Vector3> m_weaponPositions;
+        AZStd::vector<AZ::Vector3> m_pendingWeaponPositions;
+    };
+}
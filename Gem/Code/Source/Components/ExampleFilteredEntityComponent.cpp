@@ -5,7 +5,16 @@
  *
  */
 
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/conversions.h>
 #include <Components/ExampleFilteredEntityComponent.h>
 #include <Multiplayer/IMultiplayer.h>
 
@@ -13,6 +22,30 @@ AZ_CVAR(bool, mps_EnableFilteringEntities, true, nullptr, AZ::ConsoleFunctorFlag
 
 namespace MultiplayerSample
 {
+    static void mps_FilterEntitiesBenchmark(const AZ::ConsoleCommandContainer& arguments)
+    {
+        ExampleFilteredEntityComponent* filter = azrtti_cast<ExampleFilteredEntityComponent*>(AZ::Interface<Multiplayer::IFilterEntityManager>::Get());
+        if (filter == nullptr)
+        {
+            AZLOG_WARN("mps_FilterEntitiesBenchmark requires an active ExampleFilteredEntityComponent");
+            return;
+        }
+
+        uint32_t entityCount = 5000;
+        uint32_t connectionCount = 1000;
+        if (arguments.size() > 0)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(entityCount, arguments[0]);
+        }
+        if (arguments.size() > 1)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(connectionCount, arguments[1]);
+        }
+        filter->Benchmark(AZ::GetMax(entityCount, 1u), AZ::GetMax(connectionCount, 1u));
+    }
+    AZ_CONSOLEFREEFUNC(mps_FilterEntitiesBenchmark, AZ::ConsoleFunctorFlags::Null,
+        "Times name based filtering against IsEntityFiltered, optional arguments are the number of entities and the number of connections");
+
     void ExampleFilteredEntityComponent::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
@@ -43,33 +76,202 @@ namespace MultiplayerSample
 
     void ExampleFilteredEntityComponent::Activate()
     {
+        // The filter configuration only changes while the component is inactive, so any stored mask may be stale
+        m_entityMasks.clear();
+        RebuildConnectionClassMasks();
+
+        AZ::EntitySystemBus::Handler::BusConnect();
+
+        // Entities activated before this component won't send OnEntityActivated
+        AZ::Interface<AZ::ComponentApplicationRequests>::Get()->EnumerateEntities([this](AZ::Entity* entity)
+        {
+            if (entity->GetState() == AZ::Entity::State::Active)
+            {
+                SetEntityMask(entity->GetId(), CalculateEntityMask(entity->GetName()));
+            }
+        });
+
         AZ::Interface<IFilterEntityManager>::Register(this);
     }
 
     void ExampleFilteredEntityComponent::Deactivate()
     {
         AZ::Interface<IFilterEntityManager>::Unregister(this);
+        AZ::EntitySystemBus::Handler::BusDisconnect();
+
+        m_entityMasks.clear();
     }
 
     bool ExampleFilteredEntityComponent::IsEntityFiltered(
-        [[maybe_unused]] AZ::Entity* entity,
+        AZ::Entity* entity,
         [[maybe_unused]] Multiplayer::ConstNetworkEntityHandle controllerEntity,
-        [[maybe_unused]] AzNetworking::ConnectionId connectionId)
+        AzNetworking::ConnectionId connectionId)
     {
         if (m_enabled && mps_EnableFilteringEntities)
         {
-            // Note: @IsEntityFiltered is a hot code path, so do your best to optimize this method.
-            // This example just uses entity names for filtering, for the sake of simplicity.
-            // In practice, one might implement this lookup using a specialized structure such as AZStd::map<AZ::EntityId, bool>, etc.
+            // Note: @IsEntityFiltered is a hot code path, the name matching happens when the entity activates and is stored as a group mask
+            const FilterGroupMask connectionMask = m_connectionClassMasks[static_cast<uint32_t>(connectionId) % 2];
+            return (GetEntityMask(entity->GetId()) & connectionMask) != 0;
+        }
+
+        return false;
+    }
+
+    void ExampleFilteredEntityComponent::Benchmark(uint32_t entityCount, uint32_t connectionCount)
+    {
+        if (!m_enabled || !mps_EnableFilteringEntities)
+        {
+            AZLOG_WARN("mps_FilterEntitiesBenchmark requires entity filtering to be enabled");
+            return;
+        }
+
+        // Cycle through names matching each filter and names matching neither
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        entities.reserve(entityCount);
+        for (uint32_t index = 0; index < entityCount; ++index)
+        {
+            const AZStd::string suffix = AZStd::to_string(index);
+            switch (index % 3)
+            {
+            case 0:
+                entities.emplace_back(AZStd::make_unique<AZ::Entity>(m_filterNamesForEvenConnectionIds + suffix));
+                break;
+            case 1:
+                entities.emplace_back(AZStd::make_unique<AZ::Entity>(m_filterNamesForOddConnectionIds + suffix));
+                break;
+            default:
+                entities.emplace_back(AZStd::make_unique<AZ::Entity>("Unfiltered " + suffix));
+                break;
+            }
+        }
 
-            const bool evenConnectionId = static_cast<uint32_t>(connectionId) % 2 == 0;
+        // What activating the entities costs, paid once per entity rather than on a first filter call
+        const AZStd::chrono::steady_clock::time_point registerStart = AZStd::chrono::steady_clock::now();
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            SetEntityMask(entity->GetId(), CalculateEntityMask(entity->GetName()));
+        }
+        const AZStd::chrono::duration<double, AZStd::nano> registerElapsed = AZStd::chrono::steady_clock::now() - registerStart;
+        const double activateNs = registerElapsed.count() / entityCount;
 
-            if (entity->GetName().starts_with( evenConnectionId ? m_filterNamesForEvenConnectionIds : m_filterNamesForOddConnectionIds ))
+        const uint64_t callCount = static_cast<uint64_t>(entityCount) * connectionCount;
+        auto timeFiltering = [&entities, connectionCount, callCount](auto&& isFiltered)
+        {
+            uint64_t filteredCount = 0;
+            const AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
+            for (uint32_t connection = 0; connection < connectionCount; ++connection)
             {
-                return true;
+                const AzNetworking::ConnectionId connectionId{ connection };
+                for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+                {
+                    filteredCount += isFiltered(*entity, connectionId) ? 1 : 0;
+                }
             }
+            const AZStd::chrono::duration<double, AZStd::nano> elapsed = AZStd::chrono::steady_clock::now() - start;
+            return AZStd::make_pair(elapsed.count() / callCount, filteredCount);
+        };
+
+        const auto [nameNs, nameFiltered] = timeFiltering(
+            [this](const AZ::Entity& entity, AzNetworking::ConnectionId connectionId)
+        {
+            return IsFilteredByName(entity, connectionId);
+        });
+        const auto [maskNs, maskFiltered] = timeFiltering(
+            [this](AZ::Entity& entity, AzNetworking::ConnectionId connectionId)
+        {
+            return IsEntityFiltered(&entity, {}, connectionId);
+        });
+
+        // The generated entities are destroyed without ever activating, so nothing else removes their masks
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            SetEntityMask(entity->GetId(), 0);
         }
 
-        return false;
+        AZLOG_INFO("Entity filter benchmark: %u entities, %u connections, activation %.2f ns/entity, names %.2f ns/call, masks %.2f ns/call (%.2fx)",
+            entityCount, connectionCount, activateNs, nameNs, maskNs, (maskNs > 0.0) ? nameNs / maskNs : 0.0);
+        AZ_Warning("ExampleFilteredEntityComponent", nameFiltered == maskFiltered,
+            "Mask based filtering filtered %llu entities, name based filtering filtered %llu",
+            static_cast<unsigned long long>(maskFiltered), static_cast<unsigned long long>(nameFiltered));
+    }
+
+    void ExampleFilteredEntityComponent::OnEntityActivated(const AZ::EntityId& entityId)
+    {
+        if (const AZ::Entity* entity = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->FindEntity(entityId))
+        {
+            SetEntityMask(entityId, CalculateEntityMask(entity->GetName()));
+        }
+    }
+
+    void ExampleFilteredEntityComponent::OnEntityDeactivated(const AZ::EntityId& entityId)
+    {
+        // Entities are always deactivated before they are destroyed, so this also covers destruction
+        SetEntityMask(entityId, 0);
+    }
+
+    void ExampleFilteredEntityComponent::OnEntityNameChanged(const AZ::EntityId& entityId, const AZStd::string& name)
+    {
+        // Only active entities are stored, an inactive entity gets its mask when it activates
+        const AZ::Entity* entity = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->FindEntity(entityId);
+        if ((entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active))
+        {
+            SetEntityMask(entityId, CalculateEntityMask(name));
+        }
+    }
+
+    void ExampleFilteredEntityComponent::RebuildConnectionClassMasks()
+    {
+        m_connectionClassMasks[0] = EvenConnectionGroup;
+        m_connectionClassMasks[1] = OddConnectionGroup;
+    }
+
+    ExampleFilteredEntityComponent::FilterGroupMask ExampleFilteredEntityComponent::CalculateEntityMask(const AZStd::string& name) const
+    {
+        FilterGroupMask mask = 0;
+        if (name.starts_with(m_filterNamesForEvenConnectionIds))
+        {
+            mask |= EvenConnectionGroup;
+        }
+        if (name.starts_with(m_filterNamesForOddConnectionIds))
+        {
+            mask |= OddConnectionGroup;
+        }
+        return mask;
+    }
+
+    void ExampleFilteredEntityComponent::SetEntityMask(AZ::EntityId entityId, FilterGroupMask mask)
+    {
+        auto maskIter = AZStd::lower_bound(m_entityMasks.begin(), m_entityMasks.end(), entityId,
+            [](const EntityMask& entityMask, AZ::EntityId id) { return entityMask.m_entityId < id; });
+        const bool found = (maskIter != m_entityMasks.end()) && (maskIter->m_entityId == entityId);
+        if (mask == 0)
+        {
+            // Entities in no group are never filtered, leaving them out keeps the array at the size of the filtered set
+            if (found)
+            {
+                m_entityMasks.erase(maskIter);
+            }
+        }
+        else if (found)
+        {
+            maskIter->m_mask = mask;
+        }
+        else
+        {
+            m_entityMasks.insert(maskIter, EntityMask{ entityId, mask });
+        }
+    }
+
+    ExampleFilteredEntityComponent::FilterGroupMask ExampleFilteredEntityComponent::GetEntityMask(AZ::EntityId entityId) const
+    {
+        auto maskIter = AZStd::lower_bound(m_entityMasks.begin(), m_entityMasks.end(), entityId,
+            [](const EntityMask& entityMask, AZ::EntityId id) { return entityMask.m_entityId < id; });
+        return ((maskIter != m_entityMasks.end()) && (maskIter->m_entityId == entityId)) ? maskIter->m_mask : 0;
+    }
+
+    bool ExampleFilteredEntityComponent::IsFilteredByName(const AZ::Entity& entity, AzNetworking::ConnectionId connectionId) const
+    {
+        const bool evenConnectionId = static_cast<uint32_t>(connectionId) % 2 == 0;
+        return entity.GetName().starts_with(evenConnectionId ? m_filterNamesForEvenConnectionIds : m_filterNamesForOddConnectionIds);
     }
 }
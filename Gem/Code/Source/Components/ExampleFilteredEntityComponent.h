@@ -8,18 +8,28 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/MultiplayerTypes.h>
 #include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
 
 namespace MultiplayerSample
 {
     //! @class ExampleFilteredEntityComponent
     //! @brief An example of using IFilterEntityManager to filter entities to clients.
+    //!
+    //! Each entity gets a bitmask of the filter groups its name matches, computed when the entity activates and again
+    //! whenever it is renamed. Only active entities in at least one group are stored, in a flat array sorted by EntityId,
+    //! and they are removed when they deactivate. Each connection class (even or odd connection ids) has the mask of the
+    //! groups filtered from it, so filtering an entity for a connection is a binary search by id and a single AND.
     class ExampleFilteredEntityComponent final
         : public AZ::Component
         , public Multiplayer::IFilterEntityManager
+        , private AZ::EntitySystemBus::Handler
     {
     public:
-        AZ_COMPONENT(MultiplayerSample::ExampleFilteredEntityComponent, "{7BF3BF1D-383A-40E7-BCF2-1ED5B2D2A43C}");
+        AZ_COMPONENT(MultiplayerSample::ExampleFilteredEntityComponent, "{7BF3BF1D-383A-40E7-BCF2-1ED5B2D2A43C}", Multiplayer::IFilterEntityManager);
 
         static void Reflect(AZ::ReflectContext* context);
 
@@ -34,10 +44,54 @@ namespace MultiplayerSample
         bool IsEntityFiltered(AZ::Entity* entity, Multiplayer::ConstNetworkEntityHandle controllerEntity, AzNetworking::ConnectionId connectionId) override;
         //! }@
 
+        //! Times registering the masks of generated entities, then name based filtering and IsEntityFiltered of them against
+        //! every connection, and logs the results. The generated entities are unregistered afterwards.
+        //! @param entityCount the number of entities to filter
+        //! @param connectionCount the number of connections each entity is filtered for
+        void Benchmark(uint32_t entityCount, uint32_t connectionCount);
+
     private:
+        using FilterGroupMask = uint32_t;
+
+        //! Filter groups, an entity belongs to a group if its name starts with the group's prefix.
+        enum FilterGroup : FilterGroupMask
+        {
+            EvenConnectionGroup = 1 << 0,
+            OddConnectionGroup = 1 << 1
+        };
+
+        //! AZ::EntitySystemBus overrides.
+        //! @{
+        void OnEntityActivated(const AZ::EntityId& entityId) override;
+        void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+        void OnEntityNameChanged(const AZ::EntityId& entityId, const AZStd::string& name) override;
+        //! }@
+
+        void RebuildConnectionClassMasks();
+        FilterGroupMask CalculateEntityMask(const AZStd::string& name) const;
+        bool IsFilteredByName(const AZ::Entity& entity, AzNetworking::ConnectionId connectionId) const;
+
+        //! Stores the mask of an entity, a mask of 0 removes the entity.
+        void SetEntityMask(AZ::EntityId entityId, FilterGroupMask mask);
+
+        //! Returns the stored mask of an entity, 0 if it has none.
+        FilterGroupMask GetEntityMask(AZ::EntityId entityId) const;
+
+        struct EntityMask
+        {
+            AZ::EntityId m_entityId;
+            FilterGroupMask m_mask = 0;
+        };
+
         bool m_enabled = true;
 
         AZStd::string m_filterNamesForEvenConnectionIds{ "Filter Even" };
         AZStd::string m_filterNamesForOddConnectionIds{ "Filter Odd" };
+
+        //! Masks of the active entities in at least one filter group, sorted by EntityId
+        AZStd::vector<EntityMask> m_entityMasks;
+
+        //! The groups filtered from even connection ids at index 0 and from odd connection ids at index 1
+        AZStd::array<FilterGroupMask, 2> m_connectionClassMasks = { { 0, 0 } };
     };
 }
@@ -6,50 +6,71 @@
  */
 
 #include <Source/Components/NetworkAiComponent.h>
+#include <Source/Ai/AiSystem.h>
+#include <Source/Components/NetworkSimplePlayerCameraComponent.h>
+#include <Source/Spatial/CharacterSpatialHash.h>
 #include <Source/Components/NetworkPlayerMovementComponent.h>
 #include <Source/Components/NetworkWeaponsComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/LocalPredictionPlayerInputComponent.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Time/ITime.h>
 
 namespace MultiplayerSample
 {
+    AZ_CVAR(AZ::TimeMs, mps_AiPlaybackMaxStartDelayMs, AZ::TimeMs{ 5000 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "AI characters replaying recorded inputs stand still for a random time up to this value before starting");
+
+    AZ_CVAR(float, sv_AiTargetRange, 30.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "AI characters pick targets up to this distance away");
+    AZ_CVAR(float, sv_AiTargetConeHalfAngle, 60.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "AI characters pick targets within this many degrees of their facing direction");
+    AZ_CVAR_EXTERNED(float, cl_AimStickScaleZ);
+
     constexpr static float SecondsToMs = 1000.f;
+    constexpr static float TargetLostRangeScale = 1.5f;
 
     NetworkAiComponentController::NetworkAiComponentController(NetworkAiComponent& parent)
         : NetworkAiComponentControllerBase(parent)
     {
     }
 
-#if AZ_TRAIT_SERVER
-    void NetworkAiComponentController::TickMovement(NetworkPlayerMovementComponentController& movementController, float deltaTime)
+    bool NetworkAiComponentController::TickMovement(AiState& state, NetworkPlayerMovementComponentController& movementController, float deltaTime) const
     {
         // TODO: Execute this tick only if this component is owned by this endpoint (currently ticks on server only)
         float deltaTimeMs = deltaTime * SecondsToMs;
-        ModifyRemainingTimeMs() -= deltaTimeMs;
+        state.m_remainingTimeMs -= deltaTimeMs;
 
-        if (GetRemainingTimeMs() <= 0)
+        const bool newDirective = (state.m_remainingTimeMs <= 0);
+        if (newDirective)
         {
             // Determine a new directive after 500 to 9500 ms
-            SetRemainingTimeMs(m_lcg.GetRandomFloat() * (GetActionIntervalMaxMs() - GetActionIntervalMinMs()) + GetActionIntervalMinMs());
-            SetTurnRate(1.f / GetRemainingTimeMs());
+            state.m_directiveDurationMs = state.GetRandomFloat() * (GetActionIntervalMaxMs() - GetActionIntervalMinMs()) + GetActionIntervalMinMs();
+            state.m_remainingTimeMs = state.m_directiveDurationMs;
+            state.m_turnRate = 1.f / state.m_directiveDurationMs;
 
             // Randomize new target yaw and pitch and compute the delta from the current yaw and pitch respectively
-            SetTargetYawDelta(-movementController.m_viewYaw + (m_lcg.GetRandomFloat() * 2.f - 1.f));
-            SetTargetPitchDelta(-movementController.m_viewPitch + (m_lcg.GetRandomFloat() - 0.5f));
+            state.m_targetYawDelta = AiYawDelta(-movementController.m_viewYaw + (state.GetRandomFloat() * 2.f - 1.f));
+            state.m_targetPitchDelta = AiPitchDelta(-movementController.m_viewPitch + (state.GetRandomFloat() - 0.5f));
 
             // Randomize the action and strafe direction (used only if we decide to strafe)
-            SetAction(static_cast<Action>(m_lcg.GetRandom() % static_cast<int>(Action::COUNT)));
-            SetStrafingRight(static_cast<bool>(m_lcg.GetRandom() % 2));
+            state.m_action = static_cast<Action>(state.GetRandom() % static_cast<int>(Action::COUNT));
+            state.m_strafingRight = static_cast<bool>(state.GetRandom() % 2);
+
+            // Look for the closest character in front of us to aim at for this directive
+            state.m_targetNetEntityId = FindTarget(movementController);
         }
 
         // Translate desired motion into inputs
 
-        // Interpolate the current view yaw and pitch values towards the desired values
-        movementController.m_viewYaw += GetTurnRate() * deltaTimeMs * GetTargetYawDelta();
-        movementController.m_viewPitch += GetTurnRate() * deltaTimeMs * GetTargetPitchDelta();
+        // Interpolate the current view yaw and pitch values towards the desired values, or turn towards the target if we have one
+        movementController.m_viewPitch += state.m_turnRate * deltaTimeMs * state.m_targetPitchDelta;
+        if (!SteerTowardsTarget(state, movementController))
+        {
+            movementController.m_viewYaw += state.m_turnRate * deltaTimeMs * state.m_targetYawDelta;
+        }
 
         // Reset keyboard movement inputs decided on the previous frame
         movementController.m_forwardDown = false;
@@ -60,7 +81,7 @@ namespace MultiplayerSample
         movementController.m_jumping = false;
         movementController.m_crouching = false;
 
-        switch (GetAction())
+        switch (state.m_action)
         {
         case Action::Default:
             movementController.m_forwardDown = true;
@@ -78,7 +99,7 @@ namespace MultiplayerSample
             movementController.m_crouching = true;
             break;
         case Action::Strafing:
-            if (GetStrafingRight())
+            if (state.m_strafingRight)
             {
                 movementController.m_rightDown = true;
             }
@@ -90,29 +111,166 @@ namespace MultiplayerSample
         default:
             break;
         }
+
+        return newDirective;
+    }
+
+    Multiplayer::NetEntityId NetworkAiComponentController::FindTarget(const NetworkPlayerMovementComponentController& movementController) const
+    {
+        const CharacterSpatialHash* spatialHash = AZ::Interface<CharacterSpatialHash>::Get();
+        if (spatialHash == nullptr)
+        {
+            return Multiplayer::InvalidNetEntityId;
+        }
+
+        const AZ::Transform& worldTm = movementController.GetEntity()->GetTransform()->GetWorldTM();
+        return spatialHash->FindNearestInCone(worldTm.GetTranslation(), worldTm.GetBasisY().GetNormalized(), sv_AiTargetRange,
+            AZ::DegToRad(sv_AiTargetConeHalfAngle), GetNetEntityId());
+    }
+
+    bool NetworkAiComponentController::SteerTowardsTarget(AiState& state, NetworkPlayerMovementComponentController& movementController) const
+    {
+        if (state.m_targetNetEntityId == Multiplayer::InvalidNetEntityId)
+        {
+            return false;
+        }
+
+        const CharacterSpatialHash* spatialHash = AZ::Interface<CharacterSpatialHash>::Get();
+        const AZ::Vector3 position = movementController.GetEntity()->GetTransform()->GetWorldTranslation();
+        AZ::Vector3 targetPosition;
+        const float maxRange = sv_AiTargetRange * TargetLostRangeScale;
+        if ((spatialHash == nullptr) || !spatialHash->GetPosition(state.m_targetNetEntityId, targetPosition)
+            || (targetPosition.GetDistanceSq(position) > maxRange * maxRange))
+        {
+            state.m_targetNetEntityId = Multiplayer::InvalidNetEntityId;
+            return false;
+        }
+
+        // Characters face along their local Y axis, rotated about Z by the aim yaw
+        const AZ::Vector3 offset = targetPosition - position;
+        const float targetYaw = AZ::Atan2(-offset.GetX(), offset.GetY());
+        const float currentYaw = movementController.GetNetworkSimplePlayerCameraComponentController()->GetAimAngles().GetZ();
+        const float yawError = movementController.NormalizeHeading(targetYaw - currentYaw);
+
+        // Processing the input subtracts the view yaw scaled by cl_AimStickScaleZ from the aim yaw
+        movementController.m_viewYaw = AZ::GetClamp(-yawError / AZ::GetMax(static_cast<float>(cl_AimStickScaleZ), AZ::Constants::FloatEpsilon), -1.0f, 1.0f);
+        return true;
     }
 
-    void NetworkAiComponentController::TickWeapons(NetworkWeaponsComponentController& weaponsController, float deltaTime)
+    bool NetworkAiComponentController::TickWeapons(AiState& state, NetworkWeaponsComponentController& weaponsController, float deltaTime) const
     {
         // TODO: Execute this tick only if this component is owned by this endpoint (currently ticks on server only)
-        ModifyTimeToNextShot() -= deltaTime * SecondsToMs;
-        if (GetTimeToNextShot() <= 0)
+        state.m_timeToNextShot -= deltaTime * SecondsToMs;
+        if (state.m_timeToNextShot > 0)
         {
-            if (GetShotFired())
-            {
-                // Fire weapon between 100 and 10000 ms from now
-                SetTimeToNextShot(m_lcg.GetRandomFloat() * (GetFireIntervalMaxMs() - GetFireIntervalMinMs()) + GetFireIntervalMinMs());
-                SetShotFired(false);
-                weaponsController.m_weaponFiring = false;
-            }
-            else
-            {
-                weaponsController.m_weaponFiring = true;
-                SetShotFired(true);
-            }
+            return false;
         }
+
+        if (state.m_shotFired)
+        {
+            // Fire weapon between 100 and 10000 ms from now
+            state.m_timeToNextShot = state.GetRandomFloat() * (GetFireIntervalMaxMs() - GetFireIntervalMinMs()) + GetFireIntervalMinMs();
+            state.m_shotFired = false;
+            weaponsController.m_weaponFiring = false;
+        }
+        else
+        {
+            weaponsController.m_weaponFiring = true;
+            state.m_shotFired = true;
+        }
+        return true;
     }
 
+    AiState NetworkAiComponentController::LoadAiState() const
+    {
+        if (IsNetEntityRoleAuthority())
+        {
+            return GetState();
+        }
+
+        AiState state;
+        state.SetSeed(static_cast<uint64_t>(GetNetEntityId()));
+        return state;
+    }
+
+    void NetworkAiComponentController::StoreAiState(const AiState& state)
+    {
+        if (GetState() != state)
+        {
+            SetState(state);
+        }
+    }
+
+    bool NetworkAiComponentController::PlaybackMovementInput(NetworkPlayerMovementComponentNetworkInput& movementInput)
+    {
+        const RecordedInputFrame* frame = AdvancePlayback(m_movementPlaybackFrame);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        movementInput.m_forwardAxis = frame->m_forwardAxis;
+        movementInput.m_strafeAxis = frame->m_strafeAxis;
+        movementInput.m_viewYaw = frame->m_viewYaw;
+        movementInput.m_viewPitch = frame->m_viewPitch;
+        movementInput.m_sprint = frame->m_sprint;
+        movementInput.m_jump = frame->m_jump;
+        movementInput.m_crouch = frame->m_crouch;
+        return true;
+    }
+
+    bool NetworkAiComponentController::PlaybackWeaponsInput(NetworkWeaponsComponentNetworkInput& weaponsInput)
+    {
+        const RecordedInputFrame* frame = AdvancePlayback(m_weaponsPlaybackFrame);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        weaponsInput.m_draw = frame->m_draw;
+        weaponsInput.m_firing = frame->m_firing;
+        return true;
+    }
+
+    const RecordedInputFrame* NetworkAiComponentController::AdvancePlayback(uint32_t& playbackFrame)
+    {
+        const AiSystem* aiSystem = AZ::Interface<AiSystem>::Get();
+        const InputRecording* recording = aiSystem->GetPlaybackRecording();
+        if (recording == nullptr)
+        {
+            return nullptr;
+        }
+
+        // A different recording was loaded since playback started, start it over from the beginning
+        if (m_playbackStarted && (m_playbackGeneration != aiSystem->GetPlaybackGeneration()))
+        {
+            m_movementPlaybackFrame = 0;
+            m_weaponsPlaybackFrame = 0;
+            m_playbackStarted = false;
+        }
+
+        if (!m_playbackStarted)
+        {
+            // Start every character at a random point of the recording after a random delay so they don't move in lockstep
+            AiState state = LoadAiState();
+            const int64_t inputRateMs = AZ::GetMax<int64_t>(static_cast<int64_t>(recording->GetInputRateMs()), 1);
+            const AZ::TimeMs maxDelayMs = mps_AiPlaybackMaxStartDelayMs;
+            const uint32_t maxDelayFrames = aznumeric_cast<uint32_t>(static_cast<int64_t>(maxDelayMs) / inputRateMs);
+            m_playbackStartFrame = state.GetRandom() % recording->GetFrameCount();
+            m_playbackDelayFrames = (maxDelayFrames > 0) ? state.GetRandom() % maxDelayFrames : 0;
+            m_playbackGeneration = aiSystem->GetPlaybackGeneration();
+            m_playbackStarted = true;
+        }
+
+        const uint32_t frameIndex = playbackFrame++;
+        if (frameIndex < m_playbackDelayFrames)
+        {
+            return &m_idleFrame;
+        }
+        return &recording->GetFrame((m_playbackStartFrame + frameIndex - m_playbackDelayFrames) % recording->GetFrameCount());
+    }
+
+#if AZ_TRAIT_SERVER
     void NetworkAiComponentController::ConfigureAi(
             float fireIntervalMinMs, float fireIntervalMaxMs, float actionIntervalMinMs, float actionIntervalMaxMs, uint64_t seed)
     {
@@ -120,7 +278,7 @@ namespace MultiplayerSample
         SetFireIntervalMaxMs(fireIntervalMaxMs);
         SetActionIntervalMinMs(actionIntervalMinMs);
         SetActionIntervalMaxMs(actionIntervalMaxMs);
-        m_lcg.SetSeed(seed);
+        ModifyState().SetSeed(seed);
     }
 #endif
 }
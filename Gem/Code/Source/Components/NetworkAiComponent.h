@@ -8,13 +8,14 @@
 #pragma once
 
 #include <Source/AutoGen/NetworkAiComponent.AutoComponent.h>
-
-#include <AzCore/Math/Random.h>
+#include <Source/Ai/InputRecording.h>
 
 namespace MultiplayerSample
 {
     class NetworkWeaponsComponentController;
+    class NetworkWeaponsComponentNetworkInput;
     class NetworkPlayerMovementComponentController;
+    class NetworkPlayerMovementComponentNetworkInput;
 
     // The NetworkAiComponent, when active, can execute behaviors and produce synthetic inputs to drive the
     // NetworkPlayerMovementComponentController and NetworkWeaponsComponentController.
@@ -27,20 +28,57 @@ namespace MultiplayerSample
         void OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating) override {};
         void OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating) override {};
 
-#if AZ_TRAIT_SERVER
-        void TickMovement(NetworkPlayerMovementComponentController& movementController, float deltaTime);
-        void TickWeapons(NetworkWeaponsComponentController& weaponsController, float deltaTime);
-#endif
+        //! Advances the movement decisions in state and writes the resulting synthetic inputs to the movement controller.
+        //! Only touches state and the provided controller, so different AI characters can be ticked concurrently.
+        //! @return true if a new movement directive was chosen
+        bool TickMovement(AiState& state, NetworkPlayerMovementComponentController& movementController, float deltaTime) const;
+
+        //! Advances the weapon decisions in state and writes the resulting synthetic inputs to the weapons controller.
+        //! Only touches state and the provided controller, so different AI characters can be ticked concurrently.
+        //! @return true if a new weapons directive was chosen
+        bool TickWeapons(AiState& state, NetworkWeaponsComponentController& weaponsController, float deltaTime) const;
+
+        //! Returns the replicated AI state, used when the AiSystem starts ticking this character.
+        //! Bot clients don't receive the replicated state, so they seed a local state from the entity id instead.
+        AiState LoadAiState() const;
+
+        //! Writes back the state ticked by the AiSystem so that it migrates with the entity.
+        //! Only called when a new directive was chosen, the remaining directive time is simulated locally in between.
+        void StoreAiState(const AiState& state);
+
+        //! Fills the movement input from the playback recording when the AiSystem has one loaded.
+        //! @return true if the input was filled from the recording
+        bool PlaybackMovementInput(NetworkPlayerMovementComponentNetworkInput& movementInput);
+
+        //! Fills the weapons input from the playback recording when the AiSystem has one loaded.
+        //! @return true if the input was filled from the recording
+        bool PlaybackWeaponsInput(NetworkWeaponsComponentNetworkInput& weaponsInput);
 
     private:
         friend class NetworkStressTestComponentController;
 
+        //! Returns the closest character in front of the AI character, or InvalidNetEntityId if there is none.
+        Multiplayer::NetEntityId FindTarget(const NetworkPlayerMovementComponentController& movementController) const;
+
+        //! Turns the view towards the current target.
+        //! @return false if there is no target or it was lost, in which case the directive's view deltas apply
+        bool SteerTowardsTarget(AiState& state, NetworkPlayerMovementComponentController& movementController) const;
+
+        //! Returns the recorded frame for the next input of a stream, or nullptr if no recording is loaded.
+        const RecordedInputFrame* AdvancePlayback(uint32_t& playbackFrame);
+
 #if AZ_TRAIT_SERVER
         void ConfigureAi(
             float fireIntervalMinMs, float fireIntervalMaxMs, float actionIntervalMinMs, float actionIntervalMaxMs, uint64_t seed);
-
-        // TODO: Technically this guy should also be authority to autonomous so we don't roll different values after a migration..
-        AZ::SimpleLcgRandom m_lcg;
 #endif
+
+        // Movement and weapons inputs are created separately, so each keeps its own position in the recording
+        uint32_t m_movementPlaybackFrame = 0;
+        uint32_t m_weaponsPlaybackFrame = 0;
+        uint32_t m_playbackStartFrame = 0;
+        uint32_t m_playbackDelayFrames = 0;
+        uint32_t m_playbackGeneration = 0; //!< The AiSystem playback generation this character started playback with
+        bool m_playbackStarted = false;
+        RecordedInputFrame m_idleFrame; //!< Played during the start delay, never modified
     };
 }
@@ -6,6 +6,7 @@
  */
 
 #include <Source/Components/NetworkAnimationComponent.h>
+#include <Source/Animation/AnimationUpdateScheduler.h>
 #include <Multiplayer/Components/NetworkCharacterComponent.h>
 #include <Source/Components/NetworkSimplePlayerCameraComponent.h>
 #include <Source/Components/NetworkPlayerMovementComponent.h>
@@ -13,9 +14,17 @@
 #include <Integration/AnimationBus.h>
 #include <Integration/AnimGraphNetworkingBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/PhysicsSetup.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <Multiplayer/IMultiplayer.h>
 
 namespace MultiplayerSample
 {
+    AZ_CVAR(bool, sv_AnimPartialSkeleton, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If enabled, dedicated servers only evaluate the joints needed by weapons and hit volumes");
+
     void NetworkAnimationComponent::NetworkAnimationComponent::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
@@ -47,11 +56,26 @@ namespace MultiplayerSample
         EMotionFX::Integration::ActorComponentNotificationBus::Handler::BusConnect(GetEntityId());
         EMotionFX::Integration::AnimGraphComponentNotificationBus::Handler::BusConnect(GetEntityId());
 
+        m_serverJointNames = GetServerJointNames();
+        m_serverSkeletonDirty = true;
+
         GetNetBindComponent()->AddEntityPreRenderEventHandler(m_preRenderEventHandler);
+
+        AnimationUpdateScheduler* scheduler = AZ::Interface<AnimationUpdateScheduler>::Get();
+        if (scheduler != nullptr && m_networkRequests != nullptr)
+        {
+            scheduler->RegisterActor(m_networkRequests);
+        }
     }
 
     void NetworkAnimationComponent::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+        AnimationUpdateScheduler* scheduler = AZ::Interface<AnimationUpdateScheduler>::Get();
+        if (scheduler != nullptr && m_networkRequests != nullptr)
+        {
+            scheduler->UnregisterActor(m_networkRequests);
+        }
+
         EMotionFX::Integration::ActorComponentNotificationBus::Handler::BusDisconnect();
     }
 
@@ -84,6 +108,15 @@ namespace MultiplayerSample
         return true;
     }
 
+    void NetworkAnimationComponent::AddServerJoint(const AZStd::string& jointName)
+    {
+        if (!jointName.empty() && AZStd::find(m_serverJointNames.begin(), m_serverJointNames.end(), jointName) == m_serverJointNames.end())
+        {
+            m_serverJointNames.push_back(jointName);
+            m_serverSkeletonDirty = true;
+        }
+    }
+
     void NetworkAnimationComponent::OnPreRender(float deltaTime)
     {
         if (m_animationGraph == nullptr || m_networkRequests == nullptr)
@@ -96,8 +129,60 @@ namespace MultiplayerSample
             constexpr bool isAuthoritative = true;
             m_networkRequests->CreateSnapshot(isAuthoritative);
         }
-        m_networkRequests->UpdateActorExternal(deltaTime);
 
+        if (m_serverSkeletonDirty && IsPartialSkeletonEnabled())
+        {
+            ApplyServerSkeleton();
+        }
+
+        m_timeSinceLastUpdate += deltaTime;
+
+        AnimationUpdateScheduler* scheduler = AZ::Interface<AnimationUpdateScheduler>::Get();
+        if (scheduler == nullptr)
+        {
+            UpdateAnimGraphParameters();
+            m_networkRequests->UpdateActorExternal(m_timeSinceLastUpdate);
+            m_timeSinceLastUpdate = 0.0f;
+            return;
+        }
+
+        const AZ::Vector3 worldPosition = GetEntity()->GetTransform()->GetWorldTranslation();
+        if (scheduler->ShouldUpdate(worldPosition, RequiresFullRateUpdate(*scheduler, worldPosition), m_timeSinceLastUpdate))
+        {
+            // Parameters are staged here, the actor itself is updated later in the frame alongside all other characters
+            UpdateAnimGraphParameters();
+            scheduler->QueueActorUpdate(m_networkRequests, m_timeSinceLastUpdate);
+            m_timeSinceLastUpdate = 0.0f;
+        }
+    }
+
+    bool NetworkAnimationComponent::RequiresFullRateUpdate(AnimationUpdateScheduler& scheduler, const AZ::Vector3& worldPosition) const
+    {
+        // The locally controlled character is always fully animated
+        if (GetNetBindComponent()->IsNetEntityRoleAutonomous())
+        {
+            return true;
+        }
+
+        // Authorities validate shots from the fire bone against the hit volumes of the targets, so keep the poses of
+        // characters using their weapons and of every character within their range current
+        if (GetNetBindComponent()->IsNetEntityRoleAuthority())
+        {
+            const CharacterAnimStateBitset& animStates = GetActiveAnimStates();
+            if (animStates.GetBit(aznumeric_cast<uint32_t>(CharacterAnimState::Aiming))
+                || animStates.GetBit(aznumeric_cast<uint32_t>(CharacterAnimState::Shooting)))
+            {
+                scheduler.ReportWeaponInUse(worldPosition);
+                return true;
+            }
+            return scheduler.IsInWeaponRange(worldPosition);
+        }
+
+        return false;
+    }
+
+    void NetworkAnimationComponent::UpdateAnimGraphParameters()
+    {
         if (m_velocityParamId == InvalidParamIndex)
         {
             m_velocityParamId = m_animationGraph->FindParameterIndex(GetVelocityParamName().c_str());
@@ -180,9 +265,89 @@ namespace MultiplayerSample
         }
     }
 
+    bool NetworkAnimationComponent::IsPartialSkeletonEnabled() const
+    {
+        // Client servers render their characters, so only dedicated servers can skip joints
+        return sv_AnimPartialSkeleton
+            && (AZ::Interface<Multiplayer::IMultiplayer>::Get()->GetAgentType() == Multiplayer::MultiplayerAgentType::DedicatedServer);
+    }
+
+    void NetworkAnimationComponent::ApplyServerSkeleton()
+    {
+        // Cleared up front, a new actor instance or server joint marks the skeleton dirty again
+        m_serverSkeletonDirty = false;
+
+        EMotionFX::ActorInstance* actorInstance = (m_actorRequests != nullptr) ? m_actorRequests->GetActorInstance() : nullptr;
+        if (actorInstance == nullptr)
+        {
+            return;
+        }
+
+        const EMotionFX::Actor* actor = actorInstance->GetActor();
+        const EMotionFX::Skeleton* skeleton = actor->GetSkeleton();
+        const size_t numJoints = skeleton->GetNumNodes();
+
+        AZStd::vector<bool> requiredJoints(numJoints, false);
+        bool hasRequiredJoints = false;
+        auto requireJoint = [&](const AZStd::string& jointName)
+        {
+            const EMotionFX::Node* joint = skeleton->FindNodeByName(jointName.c_str());
+            if (joint == nullptr)
+            {
+                AZLOG_WARN("Server joint %s was not found on the skeleton of entity %s", jointName.c_str(), GetEntity()->GetName().c_str());
+                return;
+            }
+
+            // Walk up to the root, the root has an invalid parent index which ends the loop
+            hasRequiredJoints = true;
+            for (size_t jointIndex = joint->GetNodeIndex(); jointIndex < numJoints && !requiredJoints[jointIndex];
+                jointIndex = skeleton->GetNode(jointIndex)->GetParentIndex())
+            {
+                requiredJoints[jointIndex] = true;
+            }
+        };
+
+        for (const AZStd::string& jointName : m_serverJointNames)
+        {
+            requireJoint(jointName);
+        }
+
+        // Hit volumes and ragdoll colliders are attached to joints of the actor, their poses must stay current for shot validation
+        if (const AZStd::shared_ptr<EMotionFX::PhysicsSetup>& physicsSetup = actor->GetPhysicsSetup())
+        {
+            for (const Physics::CharacterColliderNodeConfiguration& colliderNode : physicsSetup->GetHitDetectionConfig().m_nodes)
+            {
+                requireJoint(colliderNode.m_name);
+            }
+            for (const Physics::CharacterColliderNodeConfiguration& colliderNode : physicsSetup->GetRagdollConfig().m_colliders.m_nodes)
+            {
+                requireJoint(colliderNode.m_name);
+            }
+        }
+
+        // Without any known joint to keep, evaluating the whole skeleton is the only safe choice
+        if (!hasRequiredJoints)
+        {
+            return;
+        }
+
+        for (size_t jointIndex = 0; jointIndex < numJoints; ++jointIndex)
+        {
+            if (requiredJoints[jointIndex])
+            {
+                actorInstance->EnableNode(aznumeric_cast<uint16_t>(jointIndex));
+            }
+            else
+            {
+                actorInstance->DisableNode(aznumeric_cast<uint16_t>(jointIndex));
+            }
+        }
+    }
+
     void NetworkAnimationComponent::OnActorInstanceCreated([[maybe_unused]] EMotionFX::ActorInstance* actorInstance)
     {
         m_actorRequests = EMotionFX::Integration::ActorComponentRequestBus::FindFirstHandler(GetEntityId());
+        m_serverSkeletonDirty = true;
     }
 
     void NetworkAnimationComponent::OnActorInstanceDestroyed([[maybe_unused]] EMotionFX::ActorInstance* actorInstance)
@@ -29,6 +29,8 @@ namespace MultiplayerSample
     constexpr size_t InvalidParamIndex = 0xffffffffffffffff;
     constexpr int32_t  InvalidBoneId = -1;
 
+    class AnimationUpdateScheduler;
+
     class NetworkAnimationComponent
         : public NetworkAnimationComponentBase
         , private EMotionFX::Integration::ActorComponentNotificationBus::Handler
@@ -50,8 +52,17 @@ namespace MultiplayerSample
         bool GetJointTransformByName(const char* boneName, AZ::Transform& outJointTransform) const;
         bool GetJointTransformById(int32_t boneId, AZ::Transform& outJointTransform) const;
 
+        //! Keeps a joint evaluated when a dedicated server only evaluates part of the skeleton.
+        //! The joint and the chain of joints up to the root stay evaluated, all other joints are skipped.
+        //! @param jointName the name of the joint whose world transform must stay valid
+        void AddServerJoint(const AZStd::string& jointName);
+
     private:
         void OnPreRender(float deltaTime);
+        bool RequiresFullRateUpdate(AnimationUpdateScheduler& scheduler, const AZ::Vector3& worldPosition) const;
+        void UpdateAnimGraphParameters();
+        bool IsPartialSkeletonEnabled() const;
+        void ApplyServerSkeleton();
 
         //! EMotionFX::Integration::ActorComponentNotificationBus::Handler
         //! @{
@@ -66,6 +77,13 @@ namespace MultiplayerSample
 
         Multiplayer::EntityPreRenderEvent::Handler m_preRenderEventHandler;
 
+        // Time accumulated while the animation update scheduler skipped this actor
+        float m_timeSinceLastUpdate = 0.0f;
+
+        // Joints a dedicated server keeps evaluated, the skeleton mask is rebuilt when these or the actor instance change
+        AZStd::vector<AZStd::string> m_serverJointNames;
+        bool m_serverSkeletonDirty = false;
+
         EMotionFX::Integration::ActorComponentRequests* m_actorRequests = nullptr;
         EMotionFX::AnimGraphComponentNetworkRequests* m_networkRequests = nullptr;
         EMotionFX::Integration::AnimGraphComponentRequests* m_animationGraph = nullptr;
@@ -7,10 +7,17 @@
 
 #include <Source/Components/NetworkPlayerMovementComponent.h>
 
+#include <Source/Ai/AiSystem.h>
+#include <Source/Ai/InputRecording.h>
+#include <Source/LoadTest/LoadGenerator.h>
+#include <Source/LoadTest/PerfTelemetry.h>
+#include <Source/Replication/PrioritizedReplicationManager.h>
+#include <Source/Spatial/CharacterSpatialHash.h>
 #include <Source/Components/NetworkAiComponent.h>
 #include <Multiplayer/Components/NetworkCharacterComponent.h>
 #include <Source/Components/NetworkAnimationComponent.h>
 #include <Source/Components/NetworkSimplePlayerCameraComponent.h>
+#include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkTransformComponent.h>
 #include <AzCore/Time/ITime.h>
 #include <AzFramework/Components/CameraBus.h>
@@ -23,7 +30,6 @@ namespace MultiplayerSample
 
     NetworkPlayerMovementComponentController::NetworkPlayerMovementComponentController(NetworkPlayerMovementComponent& parent)
         : NetworkPlayerMovementComponentControllerBase(parent)
-        , m_updateAI{ [this] { UpdateAI(); }, AZ::Name{ "MovementControllerAi" } }
     {
         ;
     }
@@ -32,10 +38,23 @@ namespace MultiplayerSample
     {
         NetworkAiComponent* networkAiComponent = GetParent().GetNetworkAiComponent();
         m_aiEnabled = (networkAiComponent != nullptr) ? networkAiComponent->GetEnabled() : false;
+        if (!m_aiEnabled && (networkAiComponent != nullptr) && IsNetEntityRoleAutonomous())
+        {
+            // Bot clients drive their own player from the AI instead of device input
+            m_aiEnabled = AZ::Interface<LoadGenerator>::Get()->IsBotClient();
+        }
+
+        AZ::Interface<CharacterSpatialHash>::Get()->AddCharacter(GetNetEntityId(), *GetEntity()->GetTransform());
+
+        if (IsNetEntityRoleAuthority() && !m_aiEnabled)
+        {
+            // Characters driven by a connection get their connection replicated by priority around them
+            AZ::Interface<PrioritizedReplicationManager>::Get()->AddPlayer(GetEntityHandle());
+        }
+
         if (m_aiEnabled)
         {
-            m_updateAI.Enqueue(AZ::TimeMs{ 0 }, true);
-            m_networkAiComponentController = GetNetworkAiComponentController();
+            AZ::Interface<AiSystem>::Get()->RegisterMovementController(*GetNetworkAiComponentController(), *this);
         }
         else if (IsNetEntityRoleAutonomous())
         {
@@ -55,6 +74,17 @@ namespace MultiplayerSample
 
     void NetworkPlayerMovementComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+        AZ::Interface<CharacterSpatialHash>::Get()->RemoveCharacter(GetNetEntityId());
+        if (IsNetEntityRoleAuthority() && !m_aiEnabled)
+        {
+            AZ::Interface<PrioritizedReplicationManager>::Get()->RemovePlayer(GetNetEntityId());
+        }
+
+        if (m_aiEnabled)
+        {
+            AZ::Interface<AiSystem>::Get()->UnregisterMovementController(*GetNetworkAiComponentController());
+        }
+
         if (IsNetEntityRoleAutonomous() && !m_aiEnabled)
         {
             StartingPointInput::InputEventNotificationBus::MultiHandler::BusDisconnect(MoveFwdEventId);
@@ -99,10 +129,21 @@ namespace MultiplayerSample
         // Just a note for anyone who is super confused by this, ResetCount is a predictable network property, it gets set on the client
         // through correction packets
         playerInput->m_resetCount = GetNetworkTransformComponentController()->GetResetCount();
+
+        if (m_aiEnabled)
+        {
+            GetNetworkAiComponentController()->PlaybackMovementInput(*playerInput);
+        }
+        else if (InputRecorder* recorder = AZ::Interface<InputRecorder>::Get(); (recorder != nullptr) && recorder->IsRecording())
+        {
+            recorder->RecordMovementInput(*playerInput);
+        }
     }
 
     void NetworkPlayerMovementComponentController::ProcessInput(Multiplayer::NetworkInput& input, float deltaTime)
     {
+        ScopedPerfSection inputSection(PerfSection::InputProcessing);
+
         // If the input reset count doesn't match the state's reset count it can mean two things:
         //  1) On the server: we were reset and we are now receiving inputs from the client for an old reset count
         //  2) On the client: we were reset and we are replaying old inputs after being corrected
@@ -113,6 +154,12 @@ namespace MultiplayerSample
             return;
         }
 
+        if (GetNetBindComponent()->IsReprocessingInput() && IsNetEntityRoleAutonomous())
+        {
+            // Track corrections for the bot client load report
+            AZ::Interface<LoadGenerator>::Get()->RecordReprocessedInput();
+        }
+
         GetNetworkAnimationComponentController()->ModifyActiveAnimStates().SetBit(
             aznumeric_cast<uint32_t>(CharacterAnimState::Sprinting), playerInput->m_sprint);
         GetNetworkAnimationComponentController()->ModifyActiveAnimStates().SetBit(
@@ -302,15 +349,4 @@ namespace MultiplayerSample
             m_viewPitch = value;
         }
     }
-
-    void NetworkPlayerMovementComponentController::UpdateAI()
-    {
-#if AZ_TRAIT_SERVER
-        float deltaTime = static_cast<float>(m_updateAI.TimeInQueueMs()) / 1000.f;
-        if (m_networkAiComponentController != nullptr)
-        {
-            m_networkAiComponentController->TickMovement(*this, deltaTime);
-        }
-#endif
-    }
 } // namespace MultiplayerSample
@@ -58,11 +58,6 @@ namespace MultiplayerSample
         void OnHeld(float value) override;
         //! @}
 
-        void UpdateAI();
-
-        AZ::ScheduledEvent m_updateAI;
-        NetworkAiComponentController* m_networkAiComponentController = nullptr;
-
         // Technically these values should never migrate hosts since they are maintained by the autonomous client
         // But due to how the stress test chaos monkey operates, it puppets these values on the server to mimic a client
         // This means these values can and will migrate between hosts (and lose any stored state)
@@ -9,33 +9,62 @@
 
 namespace MultiplayerSample
 {
+    // SplitMix64 constants, the stream index is scaled by the golden ratio increment before mixing
+    constexpr uint64_t StreamIncrement = 0x9E3779B97F4A7C15ULL;
+    constexpr uint64_t MixMultiplier1 = 0xBF58476D1CE4E5B9ULL;
+    constexpr uint64_t MixMultiplier2 = 0x94D049BB133111EBULL;
+
+    static float ToUnitFloat(uint64_t value)
+    {
+        // The top 24 bits fill the float mantissa exactly, so the result is uniformly distributed in [0, 1)
+        constexpr float UnitScale = 1.0f / static_cast<float>(1 << 24);
+        return static_cast<float>(value >> 40) * UnitScale;
+    }
+
+    uint64_t NetworkRandomComponentController::GenerateUint64(uint64_t seed, uint64_t streamIndex)
+    {
+        uint64_t z = seed + (streamIndex + 1) * StreamIncrement;
+        z = (z ^ (z >> 30)) * MixMultiplier1;
+        z = (z ^ (z >> 27)) * MixMultiplier2;
+        return z ^ (z >> 31);
+    }
+
     uint64_t NetworkRandomComponentController::GetRandomUint64()
     {
-        // Reimplements SimpleLcgRandom's rand int with a synchronized seed
-        uint64_t& seed = ModifySeed();
-        seed = (GetSeed() * 0x5DEECE66DLL + 0xBLL) & ((1LL << 48) - 1);
-        return seed;
+        return GenerateUint64(GetSeed(), m_streamIndex++);
     }
 
     int NetworkRandomComponentController::GetRandomInt()
     {
-        // Reimplements SimpleLcgRandom's rand int with a synchronized seed
-        return static_cast<unsigned int>(GetRandomUint64() >> 16);
+        return static_cast<unsigned int>(GetRandomUint64() >> 32);
     }
 
     float NetworkRandomComponentController::GetRandomFloat()
     {
-        // Reimplements SimpleLcgRandom's rand float with a synchronized seed
-        unsigned int r = GetRandomInt();
-            r &= 0x007fffff; //sets mantissa to random bits
-            r |= 0x3f800000; //result is in [1,2), uniformly distributed
-            union
-            {
-                float f;
-                unsigned int i;
-            } u;
-            u.i = r;
-            return u.f - 1.0f;
+        return ToUnitFloat(GetRandomUint64());
+    }
+
+    void NetworkRandomComponentController::Fill(uint64_t* outValues, size_t count)
+    {
+        // Every value only depends on its own index, there is no loop carried state so the compiler can vectorize this
+        const uint64_t seed = GetSeed();
+        const uint64_t streamIndex = m_streamIndex;
+        for (size_t index = 0; index < count; ++index)
+        {
+            outValues[index] = GenerateUint64(seed, streamIndex + index);
+        }
+        m_streamIndex += count;
+    }
+
+    void NetworkRandomComponentController::FillFloats(float* outValues, size_t count)
+    {
+        const uint64_t seed = GetSeed();
+        const uint64_t streamIndex = m_streamIndex;
+        for (size_t index = 0; index < count; ++index)
+        {
+            outValues[index] = ToUnitFloat(GenerateUint64(seed, streamIndex + index));
+        }
+        m_streamIndex += count;
     }
 
     NetworkRandomComponentController::NetworkRandomComponentController(NetworkRandomComponent& parent)
@@ -44,7 +73,7 @@ namespace MultiplayerSample
 #if AZ_TRAIT_SERVER
         if (IsNetEntityRoleAuthority())
         {
-            // Setup seed on authority for proxies to pull
+            // Setup seed on authority for proxies to pull, it is only modified again if the entity migrates
             AZ::BetterPseudoRandom seedGenerator;
             uint64_t seed = 0;
             seedGenerator.GetRandom(seed);
@@ -55,7 +84,13 @@ namespace MultiplayerSample
 
     void NetworkRandomComponentController::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
-        ;
+#if AZ_TRAIT_SERVER
+        if (IsNetEntityRoleAuthority() && (entityIsMigrating == Multiplayer::EntityIsMigrating::True))
+        {
+            // The stream index restarts on this authority, derive a new seed so the values drawn before the migration don't repeat
+            SetSeed(GenerateUint64(GetSeed(), ~0ULL));
+        }
+#endif
     }
 
     void NetworkRandomComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
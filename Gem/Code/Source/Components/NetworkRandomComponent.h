@@ -13,6 +13,15 @@
 
 namespace MultiplayerSample
 {
+    //! @class NetworkRandomComponentController
+    //! @brief Counter-based random number generator drawn from by the controller.
+    //!
+    //! Every value is a pure function of the replicated seed and a stream index. The stream index is local to this
+    //! controller and isn't replicated, so drawing numbers doesn't dirty any network property. Proxies have no controller
+    //! and don't follow the stream. They can reproduce a value with GenerateUint64 from the replicated seed if the index
+    //! is sent to them some other way.
+    //! The seed only changes when the entity migrates: the new authority starts again from index 0, so it re-keys the
+    //! seed from the migrated one rather than replay the values the previous authority already drew.
     class NetworkRandomComponentController
         : public NetworkRandomComponentControllerBase
     {
@@ -25,5 +34,17 @@ namespace MultiplayerSample
         uint64_t GetRandomUint64();
         int GetRandomInt();
         float GetRandomFloat();
+
+        //! Writes the next count values of the stream to outValues and advances the stream index by count.
+        void Fill(uint64_t* outValues, size_t count);
+
+        //! Writes the next count values of the stream to outValues as floats in [0, 1) and advances the stream index by count.
+        void FillFloats(float* outValues, size_t count);
+
+        //! Returns the value at a given index of the stream for a given seed, usable on any endpoint including proxies.
+        static uint64_t GenerateUint64(uint64_t seed, uint64_t streamIndex);
+
+    private:
+        uint64_t m_streamIndex = 0;
     };
 }
@@ -10,9 +10,13 @@
 
 #include <Source/Components/NetworkAiComponent.h>
 #include <Source/Components/NetworkPlayerMovementComponent.h>
+#include <Source/LoadTest/PerfTelemetry.h>
 
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/ConnectionData/IConnectionData.h>
@@ -20,6 +24,10 @@
 
 namespace MultiplayerSample
 {
+#if AZ_TRAIT_SERVER
+    constexpr static const char* DefaultAiPrefabPath = "prefabs/player.network.spawnable";
+#endif
+
     void NetworkStressTestComponent::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
@@ -40,6 +48,7 @@ namespace MultiplayerSample
         : NetworkStressTestComponentControllerBase(owner)
 #if AZ_TRAIT_SERVER
         , m_autoSpawnTimer([this]() { HandleSpawnAiEntity(); }, AZ::Name("StressTestSpawner Event"))
+        , m_spawnQueueEvent([this]() { ProcessSpawnQueue(); }, AZ::Name("StressTestSpawnQueue Event"))
 #endif
     {
         ;
@@ -64,10 +73,17 @@ namespace MultiplayerSample
         }
 
 #if AZ_TRAIT_SERVER
+        m_spawnPrefabId = Multiplayer::PrefabEntityId(AZ::Name(GetSpawnPrefabPath().empty() ? DefaultAiPrefabPath : GetSpawnPrefabPath().c_str()));
+
         if (GetAutoSpawnIntervalMs() > AZ::Time::ZeroTimeMs)
         {
             m_autoSpawnTimer.Enqueue(GetAutoSpawnIntervalMs(), true);
         }
+
+        if (GetCaptureTelemetry())
+        {
+            AZ::Interface<PerfTelemetry>::Get()->StartCapture();
+        }
 #endif
     }
 
@@ -76,13 +92,24 @@ namespace MultiplayerSample
 #ifdef IMGUI_ENABLED
         ImGui::ImGuiUpdateListenerBus::Handler::BusDisconnect();
 #endif
+
+#if AZ_TRAIT_SERVER
+        m_spawnQueueEvent.RemoveFromQueue();
+        m_pendingSpawns.clear();
+
+        if (GetCaptureTelemetry())
+        {
+            AZ::Interface<PerfTelemetry>::Get()->StopCapture();
+        }
+#endif
     }
 
 #if AZ_TRAIT_SERVER
     void NetworkStressTestComponentController::HandleSpawnAiEntity()
     {
         const uint64_t seed = m_seed == 0 ? static_cast<uint64_t>(AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeMs()) : m_seed;
-        HandleSpawnAIEntity(nullptr, m_fireIntervalMinMs, m_fireIntervalMaxMs, m_actionIntervalMinMs, m_actionIntervalMaxMs, seed, m_teamID);
+        QueueAiSpawns(1, m_fireIntervalMinMs, m_fireIntervalMaxMs, m_actionIntervalMinMs, m_actionIntervalMaxMs, seed, m_teamID,
+            AzNetworking::InvalidConnectionId);
     }
 #endif
 
@@ -109,7 +136,7 @@ namespace MultiplayerSample
 
     void NetworkStressTestComponentController::DrawEntitySpawner()
     {
-        ImGui::SliderInt("Quantity", &m_quantity, 1, 100);
+        ImGui::SliderInt("Quantity", &m_quantity, 1, 1000);
         ImGui::SliderInt("Team ID", &m_teamID, 0, 3);
         ImGui::InputFloat("Fire Interval Min (ms)", &m_fireIntervalMinMs, 0.f, 100000.f);
         ImGui::InputFloat("Fire Interval Max (ms)", &m_fireIntervalMaxMs, 0.f, 100000.f);
@@ -123,35 +150,45 @@ namespace MultiplayerSample
         {
             uint64_t seed = m_seed == 0 ? static_cast<uint64_t>(AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeMs()) : m_seed;
 
-            for (int i = 0; i != m_quantity; ++i)
+            if (m_isServer)
             {
-                if (m_isServer)
-                {
 #if AZ_TRAIT_SERVER
-                    HandleSpawnAIEntity(
-                        nullptr,
-                        m_fireIntervalMinMs,
-                        m_fireIntervalMaxMs,
-                        m_actionIntervalMinMs,
-                        m_actionIntervalMaxMs,
-                        seed + i,
-                        m_teamID);
+                QueueAiSpawns(
+                    aznumeric_cast<uint32_t>(m_quantity),
+                    m_fireIntervalMinMs,
+                    m_fireIntervalMaxMs,
+                    m_actionIntervalMinMs,
+                    m_actionIntervalMaxMs,
+                    seed,
+                    m_teamID,
+                    AzNetworking::InvalidConnectionId);
 #endif
-                }
-                else
-                {
+            }
+            else
+            {
 #if AZ_TRAIT_CLIENT
-                    SpawnAIEntity(
-                        m_fireIntervalMinMs,
-                        m_fireIntervalMaxMs,
-                        m_actionIntervalMinMs,
-                        m_actionIntervalMaxMs,
-                        seed + i,
-                        m_teamID);
+                SpawnAIEntity(
+                    m_fireIntervalMinMs,
+                    m_fireIntervalMaxMs,
+                    m_actionIntervalMinMs,
+                    m_actionIntervalMaxMs,
+                    seed,
+                    m_teamID,
+                    aznumeric_cast<uint32_t>(m_quantity));
 #endif
-                }
             }
         }
+
+#if AZ_TRAIT_SERVER
+        if (m_isServer)
+        {
+            ImGui::Text("Pending spawns: %zu", m_pendingSpawns.size());
+            if (!m_lastSpawnReport.empty())
+            {
+                ImGui::Text("%s", m_lastSpawnReport.c_str());
+            }
+        }
+#endif
     }
 #endif // defined(IMGUI_ENABLED)
 
@@ -171,19 +208,121 @@ namespace MultiplayerSample
         const float& actionIntervalMinMs,
         const float& actionIntervalMaxMs,
         const uint64_t& seed,
-        [[maybe_unused]] const int& teamId)
+        const int& teamId,
+        const uint32_t& count)
+    {
+        QueueAiSpawns(count, fireIntervalMinMs, fireIntervalMaxMs, actionIntervalMinMs, actionIntervalMaxMs, seed, teamId,
+            invokingConnection ? invokingConnection->GetConnectionId() : AzNetworking::InvalidConnectionId);
+    }
+
+    void NetworkStressTestComponentController::QueueAiSpawns(
+        uint32_t count,
+        float fireIntervalMinMs,
+        float fireIntervalMaxMs,
+        float actionIntervalMinMs,
+        float actionIntervalMaxMs,
+        uint64_t seed,
+        int teamId,
+        AzNetworking::ConnectionId owningConnectionId)
     {
-        if (GetSpawnCount() > GetMaxSpawns())
+        if (GetMaxSpawns() > 0)
+        {
+            // Queued spawns count towards the cap so a large batch can't overshoot it
+            const uint32_t spawnsRequested = GetSpawnCount() + aznumeric_cast<uint32_t>(m_pendingSpawns.size());
+            count = (spawnsRequested < GetMaxSpawns()) ? AZ::GetMin(count, GetMaxSpawns() - spawnsRequested) : 0;
+        }
+
+        const AZStd::chrono::steady_clock::time_point queueTime = AZStd::chrono::steady_clock::now();
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            PendingAiSpawn& pendingSpawn = m_pendingSpawns.emplace_back();
+            pendingSpawn.m_fireIntervalMinMs = fireIntervalMinMs;
+            pendingSpawn.m_fireIntervalMaxMs = fireIntervalMaxMs;
+            pendingSpawn.m_actionIntervalMinMs = actionIntervalMinMs;
+            pendingSpawn.m_actionIntervalMaxMs = actionIntervalMaxMs;
+            pendingSpawn.m_seed = seed + index;
+            pendingSpawn.m_teamId = teamId;
+            pendingSpawn.m_owningConnectionId = owningConnectionId;
+            pendingSpawn.m_queueTime = queueTime;
+        }
+
+        if (!m_pendingSpawns.empty() && !m_spawnQueueEvent.IsScheduled())
+        {
+            m_spawnQueueEvent.Enqueue(AZ::Time::ZeroTimeMs);
+        }
+    }
+
+    void NetworkStressTestComponentController::ProcessSpawnQueue()
+    {
+        const AZStd::chrono::steady_clock::time_point tickStart = AZStd::chrono::steady_clock::now();
+        const uint32_t maxSpawnsPerTick = GetMaxSpawnsPerTick();
+        const float spawnBudgetMs = GetSpawnBudgetMsPerTick();
+
+        // Always spawn at least one entity per tick so the queue drains even if a single spawn exceeds the budget
+        uint32_t spawnedThisTick = 0;
+        while (!m_pendingSpawns.empty())
+        {
+            if ((maxSpawnsPerTick > 0) && (spawnedThisTick >= maxSpawnsPerTick))
+            {
+                break;
+            }
+
+            const AZStd::chrono::duration<float, AZStd::milli> tickElapsed = AZStd::chrono::steady_clock::now() - tickStart;
+            if ((spawnBudgetMs > 0.f) && (spawnedThisTick > 0) && (tickElapsed.count() >= spawnBudgetMs))
+            {
+                break;
+            }
+
+            const PendingAiSpawn& pendingSpawn = m_pendingSpawns.front();
+            CreateAiEntity(pendingSpawn);
+            const AZStd::chrono::duration<float, AZStd::milli> latency = AZStd::chrono::steady_clock::now() - pendingSpawn.m_queueTime;
+            m_spawnLatenciesMs.push_back(latency.count());
+            m_pendingSpawns.pop_front();
+            ++spawnedThisTick;
+        }
+
+        if (m_pendingSpawns.empty())
+        {
+            ReportSpawnLatencies();
+        }
+        else
+        {
+            m_spawnQueueEvent.Enqueue(AZ::Time::ZeroTimeMs);
+        }
+    }
+
+    void NetworkStressTestComponentController::ReportSpawnLatencies()
+    {
+        if (m_spawnLatenciesMs.empty())
         {
             return;
         }
-        ModifySpawnCount()++;
 
-        static Multiplayer::PrefabEntityId prefabId(AZ::Name{ "prefabs/player.network.spawnable" });
+        AZStd::sort(m_spawnLatenciesMs.begin(), m_spawnLatenciesMs.end());
+        auto percentile = [this](float fraction)
+        {
+            const size_t index = aznumeric_cast<size_t>(fraction * (m_spawnLatenciesMs.size() - 1));
+            return m_spawnLatenciesMs[index];
+        };
+
+        m_lastSpawnReport = AZStd::string::format("Spawned %zu AI, latency p50 %.1f ms, p90 %.1f ms, p99 %.1f ms, max %.1f ms",
+            m_spawnLatenciesMs.size(), percentile(0.5f), percentile(0.9f), percentile(0.99f), m_spawnLatenciesMs.back());
+        AZLOG_INFO("%s", m_lastSpawnReport.c_str());
+        m_spawnLatenciesMs.clear();
+    }
+
+    void NetworkStressTestComponentController::CreateAiEntity(const PendingAiSpawn& pendingSpawn)
+    {
+        ModifySpawnCount()++;
 
         Multiplayer::INetworkEntityManager::EntityList entityList =
             AZ::Interface<Multiplayer::IMultiplayer>::Get()->GetNetworkEntityManager()->CreateEntitiesImmediate(
-                prefabId, Multiplayer::NetEntityRole::Authority, AZ::Transform::CreateIdentity(), Multiplayer::AutoActivate::DoNotActivate);
+                m_spawnPrefabId, Multiplayer::NetEntityRole::Authority, AZ::Transform::CreateIdentity(), Multiplayer::AutoActivate::DoNotActivate);
+        if (entityList.empty())
+        {
+            AZLOG_WARN("Attempt to spawn AI prefab %s failed. Check that prefab is network enabled.", m_spawnPrefabId.m_prefabName.GetCStr());
+            return;
+        }
 
         for (const Multiplayer::NetworkEntityHandle& entityItem : entityList)
         {
@@ -193,11 +332,13 @@ namespace MultiplayerSample
         Multiplayer::NetworkEntityHandle createdEntity = entityList[0];
         // Drive inputs from AI instead of user inputs and disable camera following
         NetworkAiComponentController* networkAiController = createdEntity.FindController<NetworkAiComponentController>();
-        networkAiController->ConfigureAi(fireIntervalMinMs, fireIntervalMaxMs, actionIntervalMinMs, actionIntervalMaxMs, seed);
+        networkAiController->ConfigureAi(
+            pendingSpawn.m_fireIntervalMinMs, pendingSpawn.m_fireIntervalMaxMs, pendingSpawn.m_actionIntervalMinMs,
+            pendingSpawn.m_actionIntervalMaxMs, pendingSpawn.m_seed);
         networkAiController->SetEnabled(true);
-        if (invokingConnection)
+        if (pendingSpawn.m_owningConnectionId != AzNetworking::InvalidConnectionId)
         {
-            createdEntity.GetNetBindComponent()->SetOwningConnectionId(invokingConnection->GetConnectionId());
+            createdEntity.GetNetBindComponent()->SetOwningConnectionId(pendingSpawn.m_owningConnectionId);
         }
         createdEntity.Activate();
     }
@@ -10,6 +10,10 @@
 
 #include <Source/AutoGen/NetworkStressTestComponent.AutoComponent.h>
 
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+
 #if defined(IMGUI_ENABLED)
 #include <imgui/imgui.h>
 #include <ImGuiBus.h>
@@ -54,7 +58,20 @@ namespace MultiplayerSample
             const float& actionIntervalMinMs,
             const float& actionIntervalMaxMs,
             const uint64_t& seed,
-            const int& teamId);
+            const int& teamId,
+            const uint32_t& count);
+
+        //! Queues AI characters to be spawned over the following ticks, within the per-tick spawn budget.
+        //! Each character is seeded with seed plus its index in the batch.
+        void QueueAiSpawns(
+            uint32_t count,
+            float fireIntervalMinMs,
+            float fireIntervalMaxMs,
+            float actionIntervalMinMs,
+            float actionIntervalMaxMs,
+            uint64_t seed,
+            int teamId,
+            AzNetworking::ConnectionId owningConnectionId);
 #endif
 
 #if defined(IMGUI_ENABLED)
@@ -78,7 +95,28 @@ namespace MultiplayerSample
         int m_teamID = 0;
 
 #if AZ_TRAIT_SERVER
+        struct PendingAiSpawn
+        {
+            float m_fireIntervalMinMs = 0.f;
+            float m_fireIntervalMaxMs = 0.f;
+            float m_actionIntervalMinMs = 0.f;
+            float m_actionIntervalMaxMs = 0.f;
+            uint64_t m_seed = 0;
+            int m_teamId = 0;
+            AzNetworking::ConnectionId m_owningConnectionId = AzNetworking::InvalidConnectionId;
+            AZStd::chrono::steady_clock::time_point m_queueTime;
+        };
+
+        void ProcessSpawnQueue();
+        void CreateAiEntity(const PendingAiSpawn& pendingSpawn);
+        void ReportSpawnLatencies();
+
         AZ::ScheduledEvent m_autoSpawnTimer;
+        AZ::ScheduledEvent m_spawnQueueEvent;
+        AZStd::deque<PendingAiSpawn> m_pendingSpawns;
+        AZStd::vector<float> m_spawnLatenciesMs;
+        Multiplayer::PrefabEntityId m_spawnPrefabId;
+        AZStd::string m_lastSpawnReport;
 #endif
     };
 } // namespace MultiplayerSample
@@ -7,6 +7,10 @@
 
 #include <Source/Components/NetworkWeaponsComponent.h>
 
+#include <Source/Ai/AiSystem.h>
+#include <Source/Ai/InputRecording.h>
+#include <Source/LoadTest/LoadGenerator.h>
+#include <Source/LoadTest/PerfTelemetry.h>
 #include <Source/Components/NetworkAiComponent.h>
 #include <Source/Components/NetworkAnimationComponent.h>
 #include <Source/Components/NetworkHealthComponent.h>
@@ -62,6 +66,9 @@ namespace MultiplayerSample
             };
 
             m_weapons[weaponIndex] = AZStd::move(CreateWeapon(constructParams));
+
+            // Shots are validated against the fire bones, so servers evaluating a partial skeleton must keep them
+            GetNetworkAnimationComponent()->AddServerJoint(GetFireBoneNames(weaponIndex));
         }
 
         if (IsNetEntityRoleClient())
@@ -300,7 +307,6 @@ namespace MultiplayerSample
 
     NetworkWeaponsComponentController::NetworkWeaponsComponentController(NetworkWeaponsComponent& parent)
         : NetworkWeaponsComponentControllerBase(parent)
-        , m_updateAI{[this] { UpdateAI(); }, AZ::Name{ "WeaponsControllerAI" } }
     {
         ;
     }
@@ -309,10 +315,15 @@ namespace MultiplayerSample
     {
         NetworkAiComponent* networkAiComponent = GetParent().GetNetworkAiComponent();
         m_aiEnabled = (networkAiComponent != nullptr) ? networkAiComponent->GetEnabled() : false;
+        if (!m_aiEnabled && (networkAiComponent != nullptr) && IsNetEntityRoleAutonomous())
+        {
+            // Bot clients drive their own player from the AI instead of device input
+            m_aiEnabled = AZ::Interface<LoadGenerator>::Get()->IsBotClient();
+        }
+
         if (m_aiEnabled)
         {
-            m_updateAI.Enqueue(AZ::TimeMs{ 0 }, true);
-            m_networkAiComponentController = GetNetworkAiComponentController();
+            AZ::Interface<AiSystem>::Get()->RegisterWeaponsController(*GetNetworkAiComponentController(), *this);
         }
         else if (IsNetEntityRoleAutonomous())
         {
@@ -324,6 +335,11 @@ namespace MultiplayerSample
 
     void NetworkWeaponsComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+        if (m_aiEnabled)
+        {
+            AZ::Interface<AiSystem>::Get()->UnregisterWeaponsController(*GetNetworkAiComponentController());
+        }
+
         if (IsNetEntityRoleAutonomous() && !m_aiEnabled)
         {
             StartingPointInput::InputEventNotificationBus::MultiHandler::BusDisconnect(DrawEventId);
@@ -340,6 +356,15 @@ namespace MultiplayerSample
         weaponInput->m_draw = m_weaponDrawn;
         weaponInput->m_firing = m_weaponFiring;
 
+        if (m_aiEnabled)
+        {
+            GetNetworkAiComponentController()->PlaybackWeaponsInput(*weaponInput);
+        }
+        else if (InputRecorder* recorder = AZ::Interface<InputRecorder>::Get(); (recorder != nullptr) && recorder->IsRecording())
+        {
+            recorder->RecordWeaponsInput(*weaponInput);
+        }
+
         // All weapon indices point to the same bone so only send one instance
         uint32_t weaponIndexInt = 0;
         if (weaponInput->m_firing.GetBit(weaponIndexInt))
@@ -358,6 +383,8 @@ namespace MultiplayerSample
 
     void NetworkWeaponsComponentController::ProcessInput(Multiplayer::NetworkInput& input, [[maybe_unused]] float deltaTime)
     {
+        ScopedPerfSection inputSection(PerfSection::InputProcessing);
+
         NetworkWeaponsComponentNetworkInput* weaponInput = input.FindComponentInput<NetworkWeaponsComponentNetworkInput>();
         GetNetworkAnimationComponentController()->ModifyActiveAnimStates().SetBit(
             aznumeric_cast<uint32_t>(CharacterAnimState::Aiming), weaponInput->m_draw);
@@ -508,15 +535,4 @@ namespace MultiplayerSample
     {
         ;
     }
-
-    void NetworkWeaponsComponentController::UpdateAI()
-    {
-#if AZ_TRAIT_SERVER
-        float deltaTime = static_cast<float>(m_updateAI.TimeInQueueMs()) / 1000.f;
-        if (m_networkAiComponentController != nullptr)
-        {
-            m_networkAiComponentController->TickWeapons(*this, deltaTime);
-        }
-#endif
-    }
 } // namespace MultiplayerSample
@@ -84,8 +84,6 @@ namespace MultiplayerSample
     private:
         friend class NetworkAiComponentController;
 
-        void UpdateAI();
-
         //! Update pump for player controlled weapons
         //! @param deltaTime the time in seconds since last tick
         void UpdateWeaponFiring(float deltaTime);
@@ -101,9 +99,6 @@ namespace MultiplayerSample
         void OnHeld(float value) override;
         //! @}
 
-        AZ::ScheduledEvent m_updateAI;
-        NetworkAiComponentController* m_networkAiComponentController = nullptr;
-
         // Technically these values should never migrate hosts since they are maintained by the autonomous client
         // But due to how the stress test chaos monkey operates, it puppets these values on the server to mimick a client
         // This means these values can and will migrate between hosts (and lose any stored state)
@@ -9,14 +9,21 @@
 
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 
 namespace MultiplayerSample
 {
+    AZ_CVAR(uint32_t, mps_PrefabReleaseMaxPerTick, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of queued prefab instances released per tick, 0 for unlimited");
+    AZ_CVAR(float, mps_PrefabReleaseBudgetMs, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The time in milliseconds spent releasing queued prefab instances per tick, 0 for unlimited");
+
     void NetworkPrefabSpawnerComponent::Reflect(AZ::ReflectContext* reflection)
     {
         if (const auto serializationContext = azrtti_cast<AZ::SerializeContext*>(reflection))
@@ -48,6 +55,7 @@ namespace MultiplayerSample
         }
 
         NetworkPrefabSpawnerRequestBus::Handler::BusConnect(GetEntityId());
+        AzFramework::AssetCatalogEventBus::Handler::BusConnect();
 
         // preload
         if (m_defaultSpawnableAsset.GetId().IsValid())
@@ -65,106 +73,161 @@ namespace MultiplayerSample
 
         NetworkPrefabSpawnerRequestBus::Handler::BusDisconnect();
         AZ::Data::AssetBus::MultiHandler::BusDisconnect();
+        AzFramework::AssetCatalogEventBus::Handler::BusDisconnect();
+        m_assetIdsByPath.clear();
+
+        // Anything still queued is released right away
+        m_releaseQueueEvent.RemoveFromQueue();
+        m_releaseQueue.clear();
+
+        // The load listeners are gone, so requests still waiting on a load would never spawn. Dropping the assets discards
+        // them, the next request for an asset starts over.
+        m_assetMap.clear();
     }
 
     void NetworkPrefabSpawnerComponent::SpawnDefaultPrefab(const AZ::Transform& worldTm, PrefabCallbacks callbacks)
     {
-        AssetItem newAsset;
-        newAsset.m_pathToAsset = m_defaultSpawnableAsset.GetHint().c_str();
-        newAsset.m_spawnableAsset = m_defaultSpawnableAsset;
-        AZ::Data::AssetBus::MultiHandler::BusConnect(m_defaultSpawnableAsset.GetId());
+        AssetItem& asset = FindOrAddAsset(m_defaultSpawnableAsset, m_defaultSpawnableAsset.GetHint().c_str());
+        SpawnOrQueue(asset, SpawnRequest{ worldTm, CreateBatch(AZStd::move(callbacks), {}, 1) });
+    }
 
-        if (newAsset.m_spawnableAsset.IsReady() == false)
+    void NetworkPrefabSpawnerComponent::SpawnPrefab(const AZ::Transform& worldTm, const char* assetPath, PrefabCallbacks callbacks)
+    {
+        const AZ::Data::AssetId assetId = GetSpawnableAssetId(assetPath);
+
+        auto foundAsset = m_assetMap.find(assetId);
+        if (foundAsset != m_assetMap.end())
         {
-            newAsset.m_spawnableAsset.QueueLoad();
+            SpawnOrQueue(foundAsset->second, SpawnRequest{ worldTm, CreateBatch(AZStd::move(callbacks), {}, 1) });
+            return;
         }
 
-        m_assetMap.emplace(newAsset.m_spawnableAsset.GetId(), newAsset);
+        AZ::Data::Asset<AzFramework::Spawnable> spawnableAsset;
+        spawnableAsset.Create(assetId, false);
+        AssetItem& asset = FindOrAddAsset(spawnableAsset, assetPath);
+        SpawnOrQueue(asset, SpawnRequest{ worldTm, CreateBatch(AZStd::move(callbacks), {}, 1) });
+    }
 
-        const SpawnRequest request{ newAsset.m_spawnableAsset.GetId(), worldTm, AZStd::move(callbacks) };
-        if (newAsset.m_spawnableAsset.IsReady())
+    void NetworkPrefabSpawnerComponent::SpawnPrefabAsset(const AZ::Transform& worldTm,
+        const AZ::Data::Asset<AzFramework::Spawnable>& asset, PrefabCallbacks callbacks)
+    {
+        AssetItem& assetItem = FindOrAddAsset(asset, asset.GetHint().c_str());
+        SpawnOrQueue(assetItem, SpawnRequest{ worldTm, CreateBatch(AZStd::move(callbacks), {}, 1) });
+    }
+
+    void NetworkPrefabSpawnerComponent::SpawnPrefabBatch(AZStd::span<const AZ::Transform> worldTms,
+        const AZ::Data::Asset<AzFramework::Spawnable>& asset, PrefabCallbacks callbacks, PrefabBatchSpawnCallback onBatchSpawned)
+    {
+        if (worldTms.empty())
         {
-            CreateInstance(request, &newAsset);
+            if (onBatchSpawned)
+            {
+                onBatchSpawned({});
+            }
+            return;
         }
-        else
+
+        AssetItem& assetItem = FindOrAddAsset(asset, asset.GetHint().c_str());
+        const AZStd::shared_ptr<SpawnBatch> batch = CreateBatch(AZStd::move(callbacks), AZStd::move(onBatchSpawned), worldTms.size());
+        if (!assetItem.m_spawnableAsset.IsReady())
+        {
+            assetItem.m_pendingRequests.reserve(assetItem.m_pendingRequests.size() + worldTms.size());
+        }
+
+        for (uint32_t index = 0; index < worldTms.size(); ++index)
         {
-            m_requests.push_back(request);
+            SpawnOrQueue(assetItem, SpawnRequest{ worldTms[index], batch, index });
         }
     }
 
-    void NetworkPrefabSpawnerComponent::SpawnPrefab(const AZ::Transform& worldTm, const char* assetPath, PrefabCallbacks callbacks)
+    AZStd::shared_ptr<NetworkPrefabSpawnerComponent::SpawnBatch> NetworkPrefabSpawnerComponent::CreateBatch(
+        PrefabCallbacks&& callbacks, PrefabBatchSpawnCallback&& onBatchSpawned, size_t count)
     {
-        const AZ::Data::AssetId assetId = GetSpawnableAssetId(assetPath);
-
-        const SpawnRequest request{ assetId, worldTm, AZStd::move(callbacks) };
-        auto foundAsset = m_assetMap.find(assetId);
-        if (foundAsset != m_assetMap.end())
+        auto batch = AZStd::make_shared<SpawnBatch>();
+        batch->m_callbacks = AZStd::move(callbacks);
+        batch->m_onBatchSpawned = AZStd::move(onBatchSpawned);
+        batch->m_remainingCount = count;
+        if (batch->m_onBatchSpawned)
         {
-            if (foundAsset->second.m_spawnableAsset.IsReady())
-            {
-                CreateInstance(request, &foundAsset->second);
-            }
-            else
-            {
-                m_requests.push_back(request);
-            }
+            batch->m_tickets.resize(count);
         }
-        else
+        return batch;
+    }
+
+    void NetworkPrefabSpawnerComponent::OnInstanceSpawned(
+        SpawnBatch& batch, uint32_t batchIndex, const AZStd::shared_ptr<AzFramework::EntitySpawnTicket>& ticket)
+    {
+        if (!batch.m_tickets.empty())
         {
-            AssetItem newAsset;
-            newAsset.m_pathToAsset = assetPath;
-            newAsset.m_spawnableAsset.Create(assetId, false);
-            AZ::Data::AssetBus::MultiHandler::BusConnect(assetId);
-            newAsset.m_spawnableAsset.QueueLoad();
-            m_assetMap.emplace(assetId, newAsset);
+            batch.m_tickets[batchIndex] = ticket;
+        }
 
-            if (newAsset.m_spawnableAsset.IsReady())
-            {
-                CreateInstance(request, &newAsset);
-            }
-            else
+        if (--batch.m_remainingCount == 0)
+        {
+            if (batch.m_onBatchSpawned)
             {
-                m_requests.push_back(request);
+                batch.m_onBatchSpawned(batch.m_tickets);
             }
+
+            // The caller owns the instances from here on
+            batch.m_tickets.clear();
         }
     }
 
-    void NetworkPrefabSpawnerComponent::SpawnPrefabAsset(const AZ::Transform& worldTm,
-        const AZ::Data::Asset<AzFramework::Spawnable>& asset, PrefabCallbacks callbacks)
+    NetworkPrefabSpawnerComponent::AssetItem& NetworkPrefabSpawnerComponent::FindOrAddAsset(
+        const AZ::Data::Asset<AzFramework::Spawnable>& asset, const char* assetPath)
     {
-        AssetItem newAsset;
-        newAsset.m_pathToAsset = asset.GetHint().c_str();
+        const AZ::Data::AssetId assetId = asset.GetId();
+        auto foundAsset = m_assetMap.find(assetId);
+        if (foundAsset != m_assetMap.end())
+        {
+            return foundAsset->second;
+        }
+
+        AssetItem& newAsset = m_assetMap[assetId];
+        newAsset.m_pathToAsset = assetPath;
         newAsset.m_spawnableAsset = asset;
-        AZ::Data::AssetBus::MultiHandler::BusConnect(asset.GetId());
 
+        // Only listen while the asset is loading, OnAssetReady disconnects once it completes
         if (newAsset.m_spawnableAsset.IsReady() == false)
         {
             newAsset.m_spawnableAsset.QueueLoad();
+            AZ::Data::AssetBus::MultiHandler::BusConnect(assetId);
         }
 
-        m_assetMap.emplace(newAsset.m_spawnableAsset.GetId(), newAsset);
+        return newAsset;
+    }
 
-        const SpawnRequest request{ newAsset.m_spawnableAsset.GetId(), worldTm, AZStd::move(callbacks) };
-        if (newAsset.m_spawnableAsset.IsReady())
+    void NetworkPrefabSpawnerComponent::SpawnOrQueue(AssetItem& asset, SpawnRequest&& request)
+    {
+        if (asset.m_spawnableAsset.IsReady())
         {
-            CreateInstance(request, &newAsset);
+            CreateInstance(request, &asset);
         }
         else
         {
-            m_requests.push_back(request);
+            asset.m_pendingRequests.push_back(AZStd::move(request));
         }
     }
 
-    AZ::Data::AssetId NetworkPrefabSpawnerComponent::GetSpawnableAssetId(const char* assetPath) const
+    AZ::Data::AssetId NetworkPrefabSpawnerComponent::GetSpawnableAssetId(const char* assetPath)
     {
         if (assetPath)
         {
+            auto cachedIter = m_assetIdsByPath.find(assetPath);
+            if (cachedIter != m_assetIdsByPath.end())
+            {
+                return cachedIter->second;
+            }
+
             AZ::Data::AssetId assetId;
             AZ::Data::AssetCatalogRequestBus::BroadcastResult(
                 assetId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, assetPath,
                 AZ::Data::s_invalidAssetType, false);
             if (assetId.IsValid())
             {
+                // Misses aren't cached, the asset may still be added to the catalog
+                m_assetIdsByPath.emplace(assetPath, assetId);
                 return assetId;
             }
         }
@@ -172,16 +235,85 @@ namespace MultiplayerSample
         return {};
     }
 
+    void NetworkPrefabSpawnerComponent::QueueReleasePrefab(AZStd::shared_ptr<AzFramework::EntitySpawnTicket> ticket)
+    {
+        if (!ticket)
+        {
+            return;
+        }
+
+        m_releaseQueue.push_back(AZStd::move(ticket));
+        if (!m_releaseQueueEvent.IsScheduled())
+        {
+            m_releaseQueueEvent.Enqueue(AZ::Time::ZeroTimeMs);
+        }
+    }
+
+    void NetworkPrefabSpawnerComponent::ProcessReleaseQueue()
+    {
+        const AZStd::chrono::steady_clock::time_point tickStart = AZStd::chrono::steady_clock::now();
+        const uint32_t maxReleasesPerTick = mps_PrefabReleaseMaxPerTick;
+        const float releaseBudgetMs = mps_PrefabReleaseBudgetMs;
+
+        // Always release at least one instance per tick so the queue drains even if a single release exceeds the budget
+        uint32_t releasedThisTick = 0;
+        while (!m_releaseQueue.empty())
+        {
+            if ((maxReleasesPerTick > 0) && (releasedThisTick >= maxReleasesPerTick))
+            {
+                break;
+            }
+
+            const AZStd::chrono::duration<float, AZStd::milli> tickElapsed = AZStd::chrono::steady_clock::now() - tickStart;
+            if ((releaseBudgetMs > 0.f) && (releasedThisTick > 0) && (tickElapsed.count() >= releaseBudgetMs))
+            {
+                break;
+            }
+
+            ReleasePrefab(AZStd::move(m_releaseQueue.front()));
+            m_releaseQueue.pop_front();
+            ++releasedThisTick;
+        }
+
+        if (!m_releaseQueue.empty())
+        {
+            m_releaseQueueEvent.Enqueue(AZ::Time::ZeroTimeMs);
+        }
+    }
+
+    void NetworkPrefabSpawnerComponent::OnCatalogLoaded([[maybe_unused]] const char* catalogFile)
+    {
+        m_assetIdsByPath.clear();
+    }
+
+    void NetworkPrefabSpawnerComponent::OnCatalogAssetChanged([[maybe_unused]] const AZ::Data::AssetId& assetId)
+    {
+        m_assetIdsByPath.clear();
+    }
+
+    void NetworkPrefabSpawnerComponent::OnCatalogAssetAdded([[maybe_unused]] const AZ::Data::AssetId& assetId)
+    {
+        m_assetIdsByPath.clear();
+    }
+
+    void NetworkPrefabSpawnerComponent::OnCatalogAssetRemoved(
+        [[maybe_unused]] const AZ::Data::AssetId& assetId, [[maybe_unused]] const AZ::Data::AssetInfo& assetInfo)
+    {
+        m_assetIdsByPath.clear();
+    }
+
     void NetworkPrefabSpawnerComponent::CreateInstance(const SpawnRequest& request, const AssetItem* asset)
     {
         AZ_Assert(asset, "AssetMap didn't contain the asset id for prefab spawning");
 
-        AZ::Transform world = request.m_whereToSpawn;
+        const AZ::Transform world = request.m_whereToSpawn;
+        const AZStd::shared_ptr<SpawnBatch>& batch = request.m_batch;
+        const uint32_t batchIndex = request.m_batchIndex;
         if (asset)
         {
             auto ticket = AZStd::make_shared<AzFramework::EntitySpawnTicket>(asset->m_spawnableAsset);
 
-            auto preSpawnCallback = [world, request, ticket]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id ticketId, AzFramework::SpawnableEntityContainerView view)
+            auto preSpawnCallback = [world, batch, ticket]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id ticketId, AzFramework::SpawnableEntityContainerView view)
             {
                 const AZ::Entity* rootEntity = *view.begin();
                 if (AzFramework::TransformComponent* entityTransform = rootEntity->FindComponent<AzFramework::TransformComponent>())
@@ -189,18 +321,19 @@ namespace MultiplayerSample
                     entityTransform->SetWorldTM(world);
                 }
 
-                if (request.m_callbacks.m_beforeActivateCallback)
+                if (batch->m_callbacks.m_beforeActivateCallback)
                 {
-                    request.m_callbacks.m_beforeActivateCallback(ticket, view);
+                    batch->m_callbacks.m_beforeActivateCallback(ticket, view);
                 }
             };
 
-            auto onSpawnedCallback = [request, ticket]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id ticketId, AzFramework::SpawnableConstEntityContainerView view)
+            auto onSpawnedCallback = [batch, batchIndex, ticket]([[maybe_unused]] AzFramework::EntitySpawnTicket::Id ticketId, AzFramework::SpawnableConstEntityContainerView view)
             {
-                if (request.m_callbacks.m_onActivateCallback)
+                if (batch->m_callbacks.m_onActivateCallback)
                 {
-                    request.m_callbacks.m_onActivateCallback(ticket, view);
+                    batch->m_callbacks.m_onActivateCallback(ticket, view);
                 }
+                OnInstanceSpawned(*batch, batchIndex, ticket);
             };
 
             AZ_Assert(ticket->IsValid(), "Unable to instantiate spawnable asset");
@@ -210,8 +343,17 @@ namespace MultiplayerSample
                 optionalArgs.m_preInsertionCallback = AZStd::move(preSpawnCallback);
                 optionalArgs.m_completionCallback = AZStd::move(onSpawnedCallback);
                 AzFramework::SpawnableEntitiesInterface::Get()->SpawnAllEntities(*ticket, AZStd::move(optionalArgs));
+                return;
             }
         }
+
+        // Still count the failed instance so the batch completes
+        OnInstanceSpawned(*batch, batchIndex, nullptr);
+    }
+
+    void NetworkPrefabSpawnerComponent::ReleasePrefab([[maybe_unused]] AZStd::shared_ptr<AzFramework::EntitySpawnTicket> ticket)
+    {
+        // Dropping the last reference to the ticket despawns the instance
     }
 
     void NetworkPrefabSpawnerComponent::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
@@ -222,19 +364,12 @@ namespace MultiplayerSample
         const auto foundAsset = m_assetMap.find(assetId);
         if (foundAsset != m_assetMap.end())
         {
-            for (auto requestIterator = m_requests.begin(); requestIterator < m_requests.end(); /*iterating inside the loop body*/)
+            // Move the queue out first, spawn callbacks may request more instances of this asset
+            const AZStd::vector<SpawnRequest> pendingRequests = AZStd::move(foundAsset->second.m_pendingRequests);
+            foundAsset->second.m_pendingRequests.clear();
+            for (const SpawnRequest& request : pendingRequests)
             {
-                const SpawnRequest& request = *requestIterator;
-
-                if (request.m_assetIdToSpawn == assetId)
-                {
-                    CreateInstance(request, &foundAsset->second);
-                    requestIterator = m_requests.erase(requestIterator);
-                }
-                else
-                {
-                    ++requestIterator;
-                }
+                CreateInstance(request, &foundAsset->second);
             }
         }
     }
@@ -9,6 +9,9 @@
 
 #include <NetworkPrefabSpawnerInterface.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzFramework/Asset/AssetCatalogBus.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 
@@ -22,6 +25,7 @@ namespace MultiplayerSample
         : public AZ::Component
         , public NetworkPrefabSpawnerRequestBus::Handler
         , public AZ::Data::AssetBus::MultiHandler
+        , private AzFramework::AssetCatalogEventBus::Handler
     {
     public:
         AZ_COMPONENT(NetworkPrefabSpawnerComponent, "{7E48961B-7E39-4FBC-95E4-74B712229E9B}", Component);
@@ -39,6 +43,12 @@ namespace MultiplayerSample
         void SpawnPrefab(const AZ::Transform& worldTm, const char* assetPath, PrefabCallbacks callbacks) override;
         void SpawnPrefabAsset(const AZ::Transform& worldTm, const AZ::Data::Asset<AzFramework::Spawnable>& asset, PrefabCallbacks callbacks) override;
         void SpawnDefaultPrefab(const AZ::Transform& worldTm, PrefabCallbacks callbacks) override;
+        void SpawnPrefabBatch(AZStd::span<const AZ::Transform> worldTms, const AZ::Data::Asset<AzFramework::Spawnable>& asset,
+            PrefabCallbacks callbacks, PrefabBatchSpawnCallback onBatchSpawned) override;
+        void ReleasePrefab(AZStd::shared_ptr<AzFramework::EntitySpawnTicket> ticket) override;
+        void QueueReleasePrefab(AZStd::shared_ptr<AzFramework::EntitySpawnTicket> ticket) override;
+
+        const AZ::Data::Asset<AzFramework::Spawnable>& GetDefaultSpawnableAsset() const { return m_defaultSpawnableAsset; }
 
         // AssetBus
         void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
@@ -46,25 +56,63 @@ namespace MultiplayerSample
     private:
         AZ::Data::Asset<AzFramework::Spawnable> m_defaultSpawnableAsset;
 
-        AZ::Data::AssetId GetSpawnableAssetId(const char* assetPath) const;
+        //! AssetCatalogEventBus, any catalog change may remap paths so the path cache is dropped
+        //! @{
+        void OnCatalogLoaded(const char* catalogFile) override;
+        void OnCatalogAssetChanged(const AZ::Data::AssetId& assetId) override;
+        void OnCatalogAssetAdded(const AZ::Data::AssetId& assetId) override;
+        void OnCatalogAssetRemoved(const AZ::Data::AssetId& assetId, const AZ::Data::AssetInfo& assetInfo) override;
+        //! @}
 
-        struct AssetItem
+        AZ::Data::AssetId GetSpawnableAssetId(const char* assetPath);
+
+        //! Asset ids already resolved through the asset catalog, keyed by the path used to request them
+        AZStd::unordered_map<AZStd::string, AZ::Data::AssetId> m_assetIdsByPath;
+
+        //! Callbacks and results shared by every instance of one spawn call.
+        struct SpawnBatch
         {
-            AZStd::string m_pathToAsset;
-            AZ::Data::Asset<AzFramework::Spawnable> m_spawnableAsset;
+            PrefabCallbacks m_callbacks;
+            PrefabBatchSpawnCallback m_onBatchSpawned;
+            AZStd::vector<AZStd::shared_ptr<AzFramework::EntitySpawnTicket>> m_tickets;
+            size_t m_remainingCount = 0;
         };
-        AZStd::unordered_map<AZ::Data::AssetId, AssetItem> m_assetMap;
 
         struct SpawnRequest
         {
-            AZ::Data::AssetId m_assetIdToSpawn;
             AZ::Transform m_whereToSpawn = AZ::Transform::CreateIdentity();
-            PrefabCallbacks m_callbacks;
+            AZStd::shared_ptr<SpawnBatch> m_batch;
+            uint32_t m_batchIndex = 0;
         };
 
-        AZStd::vector<SpawnRequest> m_requests;
+        struct AssetItem
+        {
+            AZStd::string m_pathToAsset;
+            AZ::Data::Asset<AzFramework::Spawnable> m_spawnableAsset;
+            AZStd::vector<SpawnRequest> m_pendingRequests; //!< Requests waiting for this asset to finish loading
+        };
+        AZStd::unordered_map<AZ::Data::AssetId, AssetItem> m_assetMap;
 
         AZStd::vector<AZStd::shared_ptr<AzFramework::EntitySpawnTicket>> m_instanceTickets;
+
+        //! Returns the map entry for an asset, adding it and starting its load the first time the asset is requested.
+        AssetItem& FindOrAddAsset(const AZ::Data::Asset<AzFramework::Spawnable>& asset, const char* assetPath);
+
+        //! Spawns the request right away if the asset is ready, otherwise queues it on the asset until it is.
+        void SpawnOrQueue(AssetItem& asset, SpawnRequest&& request);
+
         void CreateInstance(const SpawnRequest& request, const AssetItem* asset);
+
+        //! Releases queued instances until the per-frame budget runs out, rescheduling itself while any are left.
+        void ProcessReleaseQueue();
+
+        AZStd::deque<AZStd::shared_ptr<AzFramework::EntitySpawnTicket>> m_releaseQueue;
+        AZ::ScheduledEvent m_releaseQueueEvent{ [this]() { ProcessReleaseQueue(); }, AZ::Name("NetworkPrefabSpawnerReleaseQueue") };
+
+        static AZStd::shared_ptr<SpawnBatch> CreateBatch(PrefabCallbacks&& callbacks, PrefabBatchSpawnCallback&& onBatchSpawned, size_t count);
+
+        //! Records an instance of a batch as done, calling the batch callback once every instance is active or failed.
+        //! Failed instances are recorded with a null ticket.
+        static void OnInstanceSpawned(SpawnBatch& batch, uint32_t batchIndex, const AZStd::shared_ptr<AzFramework::EntitySpawnTicket>& ticket);
     };
 }
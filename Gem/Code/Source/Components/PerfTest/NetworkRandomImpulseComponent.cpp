@@ -7,12 +7,12 @@
 
 #include <RigidBodyComponent.h>
 #include <Components/PerfTest/NetworkRandomImpulseComponent.h>
+#include <Components/PerfTest/RandomImpulseScheduler.h>
 
 namespace MultiplayerSample
 {
     NetworkRandomImpulseComponentController::NetworkRandomImpulseComponentController(NetworkRandomImpulseComponent& parent)
         : NetworkRandomImpulseComponentControllerBase(parent)
-        , m_tickEvent{ [this] { TickEvent(); }, AZ::Name{ "NetworkRandomImpulseComponent" } }
     {
     }
 
@@ -20,29 +20,16 @@ namespace MultiplayerSample
     {
         if (GetParent().GetEnableHopping())
         {
-            m_tickEvent.Enqueue(AZ::TimeMs{ 0 }, true);
-            m_accumulatedTime = 0.f;
+            if (PhysX::RigidBodyComponent* body = GetEntity()->FindComponent<PhysX::RigidBodyComponent>())
+            {
+                AZ::Interface<RandomImpulseScheduler>::Get()->AddHopper(
+                    GetEntityId(), *body, *GetEntity()->GetTransform(), GetParent().GetHopPeriod(), GetParent().GetHopForce());
+            }
         }
     }
 
     void NetworkRandomImpulseComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
-    }
-
-    void NetworkRandomImpulseComponentController::TickEvent()
-    {
-        const float deltaTime = static_cast<float>(m_tickEvent.TimeInQueueMs()) / 1000.f;
-        m_accumulatedTime += deltaTime;
-
-        if (m_accumulatedTime > GetParent().GetHopPeriod())
-        {
-            m_accumulatedTime = 0.f;
-
-            if (PhysX::RigidBodyComponent* body = GetEntity()->FindComponent<PhysX::RigidBodyComponent>())
-            {
-                const AZ::Quaternion rotation = GetEntity()->GetTransform()->GetWorldRotationQuaternion();
-                body->ApplyLinearImpulse(rotation.TransformVector(AZ::Vector3::CreateAxisZ(GetParent().GetHopForce())));
-            }
-        }
+        AZ::Interface<RandomImpulseScheduler>::Get()->RemoveHopper(GetEntityId());
     }
 }
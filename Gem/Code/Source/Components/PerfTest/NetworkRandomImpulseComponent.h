@@ -11,6 +11,7 @@
 
 namespace MultiplayerSample
 {
+    //! Hops the entity's rigid body every HopPeriod seconds, the hops themselves are applied by the RandomImpulseScheduler.
     class NetworkRandomImpulseComponentController
         : public NetworkRandomImpulseComponentControllerBase
     {
@@ -19,11 +20,5 @@ namespace MultiplayerSample
 
         void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
         void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
-        
-    private:
-        float m_accumulatedTime = 0.f;
-
-        AZ::ScheduledEvent m_tickEvent;
-        void TickEvent();
     };
 }
@@ -8,15 +8,12 @@
 #pragma once
 
 #include <Source/AutoGen/NetworkRandomTranslateComponent.AutoComponent.h>
-#include <AzCore/Component/TickBus.h>
-#include <AzCore/Math/Vector3.h>
-#include <AzCore/Math/Random.h>
 
 namespace MultiplayerSample
 {
+    //! Moves the entity between random points around its starting position, the moves are performed by the RandomTranslateMover.
     class NetworkRandomTranslateComponentController
-        : public NetworkRandomTranslateComponentControllerBase,
-          AZ::TickBus::Handler
+        : public NetworkRandomTranslateComponentControllerBase
     {
     public:
         NetworkRandomTranslateComponentController(NetworkRandomTranslateComponent& parent);
@@ -26,18 +23,5 @@ namespace MultiplayerSample
         void OnActivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
         void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
         //////////////////////////////////////////////////////////////////////////
-
-    private:
-        //////////////////////////////////////////////////////////////////////////
-        // AZ::TickBus::Handler overrides
-        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
-        //////////////////////////////////////////////////////////////////////////
-
-        AZ::Vector3 CalculateNextDestination();
-
-        AZ::Vector3 m_originalPosition = AZ::Vector3::CreateZero();
-        AZ::Vector3 m_destination = AZ::Vector3::CreateZero();
-        float m_travelTime = 0.0f;
-        AZ::SimpleLcgRandom m_simpleLcgRandom;
     };
 }
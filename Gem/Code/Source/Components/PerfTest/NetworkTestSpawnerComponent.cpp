@@ -7,10 +7,11 @@
 
 #include <NetworkPrefabSpawnerInterface.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Random.h>
 #include <Components/NetworkRandomComponent.h>
 #include <Components/PerfTest/NetworkTestSpawnerComponent.h>
-#include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Source/AutoGen/NetworkRandomComponent.AutoComponent.h>
@@ -18,6 +19,9 @@
 
 namespace MultiplayerSample
 {
+    AZ_CVAR(uint32_t, mps_TestSpawnerMaxSpawnsPerTick, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of instances a test spawner requests per tick, the rest are carried over to later ticks. 0 for unlimited");
+
     NetworkTestSpawnerComponentController::NetworkTestSpawnerComponentController(NetworkTestSpawnerComponent& parent)
         : NetworkTestSpawnerComponentControllerBase(parent)
         , m_tickEvent{ [this] { TickEvent(); }, AZ::Name{ "NetworkTestSpawnerComponent" } }
@@ -26,72 +30,125 @@ namespace MultiplayerSample
 
     void NetworkTestSpawnerComponentController::OnActivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+        m_currentCount = 0;
+
+        const SpawnPointDistribution distribution = GetParent().GetLowDiscrepancySpawnPoints()
+            ? SpawnPointDistribution::LowDiscrepancy : SpawnPointDistribution::Uniform;
+        m_spawnPointSampler.Activate(GetEntityId(), distribution, GetNetworkRandomComponentController()->GetRandomUint64());
+
+        const AZStd::string& profilePath = GetParent().GetSpawnProfilePath();
+        if (profilePath.empty() || !m_spawnRateScheduler.LoadProfile(profilePath.c_str()))
+        {
+            m_spawnRateScheduler.SetConstantRate(aznumeric_cast<float>(GetParent().GetSpawnPerSecond()));
+        }
+
         if (GetParent().GetNetworkPrefabSpawnerComponent())
         {
+            m_runActive = true;
             m_tickEvent.Enqueue(AZ::TimeMs{ 0 }, true);
         }
-
-        m_currentCount = 0;
-        m_accumulatedTime = 0.f;
-        m_sinceLastSpawn = 0.f;
     }
 
     void NetworkTestSpawnerComponentController::OnDeactivate([[maybe_unused]] Multiplayer::EntityIsMigrating entityIsMigrating)
     {
+        if (m_runActive)
+        {
+            FinishRun();
+        }
+
+        m_spawnPointSampler.Deactivate();
     }
 
     void NetworkTestSpawnerComponentController::TickEvent()
     {
         const float deltaTime = static_cast<float>(m_tickEvent.TimeInQueueMs()) / 1000.f;
-        m_accumulatedTime += deltaTime;
 
-        if (m_accumulatedTime > 1.0f / aznumeric_cast<float>(GetParent().GetSpawnPerSecond()))
+        // The scheduler carries fractional spawns, and spawns past the cap, over between ticks
+        const uint32_t maxSpawnsPerTick = mps_TestSpawnerMaxSpawnsPerTick;
+        uint32_t maxSpawns = (maxSpawnsPerTick > 0) ? maxSpawnsPerTick : AZStd::numeric_limits<uint32_t>::max();
+        if (!GetParent().GetRespawnEnabled())
         {
-            m_accumulatedTime = 0.f;
+            maxSpawns = AZ::GetMin(maxSpawns, aznumeric_cast<uint32_t>(AZ::GetMax(GetParent().GetMaxLiveCount() - m_currentCount, 0)));
+        }
 
-            AZ::Vector3 randomPoint = AZ::Vector3::CreateZero();
-            // ShapeComponentRequestsBus is designed in such a way that it's very difficult to use direct component interface instead of the EBus
-            using ShapeBus = LmbrCentral::ShapeComponentRequestsBus;
-            ShapeBus::EventResult(randomPoint, GetParent().GetEntityId(), &ShapeBus::Events::GenerateRandomPointInside,
-                AZ::RandomDistributionType::UniformReal);
+        const uint32_t spawnCount = m_spawnRateScheduler.Advance(deltaTime, maxSpawns);
 
-            AZ::Transform t = GetEntity()->GetTransform()->GetWorldTM();
-            if (!randomPoint.IsZero())
+        if (spawnCount > 0)
+        {
+            SpawnInstances(spawnCount);
+        }
+
+        if (GetParent().GetRespawnEnabled())
+        {
+            // Only instances that finished spawning have a ticket to release, the rest are picked up on a later tick
+            while ((m_currentCount >= GetParent().GetMaxLiveCount()) && !m_spawnedObjects.empty())
             {
-                t.SetTranslation(randomPoint);
-
-                // Create a random orientation for fun.
-                float randomAngles[3];
-                randomAngles[0] = aznumeric_cast<float>(GetNetworkRandomComponentController()->GetRandomUint64() % 180);
-                randomAngles[1] = aznumeric_cast<float>(GetNetworkRandomComponentController()->GetRandomUint64() % 180);
-                randomAngles[2] = aznumeric_cast<float>(GetNetworkRandomComponentController()->GetRandomUint64() % 180);
-                t.SetRotation(AZ::Quaternion::CreateFromEulerAnglesDegrees(AZ::Vector3::CreateFromFloat3(randomAngles)));
+                // The spawner destroys the prefab instance for this ticket on a later tick
+                GetParent().GetNetworkPrefabSpawnerComponent()->QueueReleasePrefab(AZStd::move(m_spawnedObjects.front()));
+                m_spawnedObjects.pop_front();
+                --m_currentCount;
             }
+        }
+        else if (m_currentCount >= GetParent().GetMaxLiveCount())
+        {
+            FinishRun();
+            return;
+        }
 
-            PrefabCallbacks callbacks;
-            callbacks.m_onActivateCallback = [this](
-                AZStd::shared_ptr<AzFramework::EntitySpawnTicket>&& ticket,
-                [[maybe_unused]] AzFramework::SpawnableConstEntityContainerView view)
-            {
-                m_spawnedObjects.push_back(move(ticket));
-            };
+        if (m_spawnRateScheduler.IsFinished())
+        {
+            FinishRun();
+        }
+    }
+
+    void NetworkTestSpawnerComponentController::SpawnInstances(uint32_t count)
+    {
+        m_spawnTransforms.clear();
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            m_spawnTransforms.push_back(GetRandomSpawnTransform());
+        }
 
-            GetParent().GetNetworkPrefabSpawnerComponent()->SpawnDefaultPrefab(t, callbacks);
+        PrefabCallbacks callbacks;
+        callbacks.m_onActivateCallback = [this, segmentIndex = m_spawnRateScheduler.GetRequestSegmentIndex()](
+            AZStd::shared_ptr<AzFramework::EntitySpawnTicket>&& ticket,
+            [[maybe_unused]] AzFramework::SpawnableConstEntityContainerView view)
+        {
+            // Only count spawns that completed, the achieved rate in the report excludes failed or pending instances.
+            // Spawns can complete on a later tick, so they are credited to the segment that requested them.
+            m_spawnRateScheduler.RecordSpawns(segmentIndex, 1);
+            m_spawnedObjects.push_back(move(ticket));
+        };
 
-            m_currentCount++;
+        NetworkPrefabSpawnerComponent* prefabSpawner = GetParent().GetNetworkPrefabSpawnerComponent();
+        prefabSpawner->SpawnPrefabBatch(m_spawnTransforms, prefabSpawner->GetDefaultSpawnableAsset(), AZStd::move(callbacks), {});
+        m_currentCount += count;
+    }
 
-            if (m_currentCount >= GetParent().GetMaxLiveCount())
+    AZ::Transform NetworkTestSpawnerComponentController::GetRandomSpawnTransform()
+    {
+        AZ::Vector3 randomPoint = AZ::Vector3::CreateZero();
+        AZ::Transform t = GetEntity()->GetTransform()->GetWorldTM();
+        if (m_spawnPointSampler.GetNextPoint(randomPoint))
+        {
+            t.SetTranslation(randomPoint);
+
+            // Create a random orientation for fun.
+            float randomAngles[3];
+            GetNetworkRandomComponentController()->FillFloats(randomAngles, AZ_ARRAY_SIZE(randomAngles));
+            for (float& angle : randomAngles)
             {
-                if (GetParent().GetRespawnEnabled())
-                {
-                    m_spawnedObjects.pop_front(); // this destroys the prefab instance for this ticket
-                    --m_currentCount;
-                }
-                else
-                {
-                    m_tickEvent.RemoveFromQueue();
-                }
+                angle *= 180.0f;
             }
+            t.SetRotation(AZ::Quaternion::CreateFromEulerAnglesDegrees(AZ::Vector3::CreateFromFloat3(randomAngles)));
         }
+        return t;
+    }
+
+    void NetworkTestSpawnerComponentController::FinishRun()
+    {
+        m_tickEvent.RemoveFromQueue();
+        m_runActive = false;
+        m_spawnRateScheduler.LogReport(GetEntity()->GetName().c_str());
     }
 }
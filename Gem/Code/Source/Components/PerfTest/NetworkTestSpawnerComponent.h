@@ -9,6 +9,8 @@
 
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 #include <Source/AutoGen/NetworkTestSpawnerComponent.AutoComponent.h>
+#include <Source/Components/PerfTest/SpawnPointSampler.h>
+#include <Source/Components/PerfTest/SpawnRateScheduler.h>
 
 namespace MultiplayerSample
 {
@@ -22,13 +24,23 @@ namespace MultiplayerSample
         void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
 
     private:
-        int m_currentCount = 0;
-        float m_accumulatedTime = 0.f;
-        float m_sinceLastSpawn = 0.f;
+        int m_currentCount = 0; //!< Instances requested and not yet released, including ones still spawning
 
         AZStd::deque<AZStd::shared_ptr<AzFramework::EntitySpawnTicket>> m_spawnedObjects;
+        AZStd::vector<AZ::Transform> m_spawnTransforms;
+
+        SpawnRateScheduler m_spawnRateScheduler;
+        SpawnPointSampler m_spawnPointSampler;
+        bool m_runActive = false;
 
         AZ::ScheduledEvent m_tickEvent;
         void TickEvent();
+
+        //! Spawns count instances at random points inside the shape in a single batch.
+        void SpawnInstances(uint32_t count);
+        AZ::Transform GetRandomSpawnTransform();
+
+        //! Stops spawning and logs the spawn rate report for this run.
+        void FinishRun();
     };
 }
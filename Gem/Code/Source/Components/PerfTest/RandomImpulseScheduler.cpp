@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Components/PerfTest/RandomImpulseScheduler.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <RigidBodyComponent.h>
+
+namespace MultiplayerSample
+{
+    void RandomImpulseScheduler::AddHopper(
+        AZ::EntityId entityId, PhysX::RigidBodyComponent& body, AZ::TransformInterface& transform, float hopPeriod, float hopForce)
+    {
+        RemoveHopper(entityId);
+
+        Hopper hopper;
+        hopper.m_entityId = entityId;
+        hopper.m_body = &body;
+        hopper.m_transform = &transform;
+        hopper.m_hopPeriodMs = AZ::TimeMs{ static_cast<int64_t>(AZ::GetMax(hopPeriod, 0.0f) * 1000.0f) };
+        hopper.m_hopForce = hopForce;
+        hopper.m_generation = ++m_nextGeneration;
+
+        m_hopperIndices[entityId] = m_hoppers.size();
+        m_hoppers.push_back(hopper);
+
+        const AZ::TimeMs nowMs = AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeMs();
+        if (m_lastTickTimeMs < AZ::TimeMs{ 0 })
+        {
+            m_lastTickTimeMs = nowMs;
+        }
+        Schedule(hopper, nowMs + hopper.m_hopPeriodMs);
+    }
+
+    void RandomImpulseScheduler::RemoveHopper(AZ::EntityId entityId)
+    {
+        auto indexIter = m_hopperIndices.find(entityId);
+        if (indexIter == m_hopperIndices.end())
+        {
+            return;
+        }
+
+        // Swap the last hopper into the freed slot to keep the array contiguous, wheel entries of the removed hopper become stale
+        const size_t index = indexIter->second;
+        m_hopperIndices.erase(indexIter);
+        if (index != m_hoppers.size() - 1)
+        {
+            m_hoppers[index] = m_hoppers.back();
+            m_hopperIndices[m_hoppers[index].m_entityId] = index;
+        }
+        m_hoppers.pop_back();
+
+        if (m_hoppers.empty())
+        {
+            // Drop the stale entries rather than visiting them once hoppers register again
+            for (AZStd::vector<WheelEntry>& entries : m_wheel)
+            {
+                entries.clear();
+            }
+            m_lastTickTimeMs = AZ::TimeMs{ -1 };
+        }
+    }
+
+    void RandomImpulseScheduler::Tick()
+    {
+        if (m_hoppers.empty())
+        {
+            return;
+        }
+
+        const AZ::TimeMs nowMs = AZ::Interface<AZ::ITime>::Get()->GetElapsedTimeMs();
+        if (m_lastTickTimeMs < AZ::TimeMs{ 0 })
+        {
+            m_lastTickTimeMs = nowMs;
+        }
+
+        // Visit the slots elapsed since the last tick, including the last one visited since it may hold hops due later in that slot.
+        // Entries due a full turn or more from now share slots with due ones and are left in place.
+        const int64_t slotMs = static_cast<int64_t>(WheelSlotMs);
+        const int64_t firstSlot = static_cast<int64_t>(m_lastTickTimeMs) / slotMs;
+        const int64_t lastSlot = static_cast<int64_t>(nowMs) / slotMs;
+        const int64_t slotCount = AZ::GetMin(lastSlot - firstSlot + 1, static_cast<int64_t>(WheelSlotCount));
+        m_dueEntries.clear();
+        for (int64_t slot = firstSlot; slot < firstSlot + slotCount; ++slot)
+        {
+            AZStd::vector<WheelEntry>& entries = m_wheel[static_cast<size_t>(slot) % WheelSlotCount];
+            auto firstLater = AZStd::partition(entries.begin(), entries.end(),
+                [nowMs](const WheelEntry& entry) { return entry.m_dueTimeMs <= nowMs; });
+            m_dueEntries.insert(m_dueEntries.end(), entries.begin(), firstLater);
+            entries.erase(entries.begin(), firstLater);
+        }
+        m_lastTickTimeMs = nowMs;
+
+        for (const WheelEntry& entry : m_dueEntries)
+        {
+            auto indexIter = m_hopperIndices.find(entry.m_entityId);
+            if ((indexIter == m_hopperIndices.end()) || (m_hoppers[indexIter->second].m_generation != entry.m_generation))
+            {
+                continue;
+            }
+
+            const Hopper& hopper = m_hoppers[indexIter->second];
+            const AZ::Quaternion rotation = hopper.m_transform->GetWorldRotationQuaternion();
+            hopper.m_body->ApplyLinearImpulse(rotation.TransformVector(AZ::Vector3::CreateAxisZ(hopper.m_hopForce)));
+
+            // Keep the hops on their original cadence, unless the frame was long enough to miss a whole period
+            AZ::TimeMs nextDueMs = entry.m_dueTimeMs + hopper.m_hopPeriodMs;
+            if (nextDueMs <= nowMs)
+            {
+                nextDueMs = nowMs + hopper.m_hopPeriodMs;
+            }
+            Schedule(hopper, nextDueMs);
+        }
+    }
+
+    void RandomImpulseScheduler::Schedule(const Hopper& hopper, AZ::TimeMs dueTimeMs)
+    {
+        m_wheel[GetSlotIndex(dueTimeMs)].push_back({ hopper.m_entityId, hopper.m_generation, dueTimeMs });
+    }
+
+    size_t RandomImpulseScheduler::GetSlotIndex(AZ::TimeMs timeMs) const
+    {
+        return static_cast<size_t>(static_cast<int64_t>(timeMs) / static_cast<int64_t>(WheelSlotMs)) % WheelSlotCount;
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace PhysX
+{
+    class RigidBodyComponent;
+}
+
+namespace MultiplayerSample
+{
+    //! @class RandomImpulseScheduler
+    //! @brief Applies the periodic hops of every NetworkRandomImpulseComponent from a single timing wheel.
+    //!
+    //! Hopping entities are kept in a contiguous array with their rigid body and transform cached when they register.
+    //! Each hop is filed in the wheel slot of its due time, and a tick only visits the slots that elapsed since the
+    //! previous tick, so the cost of a tick follows the number of hops due rather than the number of hopping entities.
+    class RandomImpulseScheduler
+    {
+    public:
+        AZ_RTTI(RandomImpulseScheduler, "{9C3E51A7-D28B-4F6E-A4C0-5B7E2D9F1A83}");
+        virtual ~RandomImpulseScheduler() = default;
+
+        //! Starts hopping an entity every hopPeriod seconds, the first hop is one period from now.
+        void AddHopper(AZ::EntityId entityId, PhysX::RigidBodyComponent& body, AZ::TransformInterface& transform, float hopPeriod, float hopForce);
+        void RemoveHopper(AZ::EntityId entityId);
+
+        //! Applies every hop that came due since the last tick.
+        //! Called once per frame by the MultiplayerSampleSystemComponent.
+        void Tick();
+
+    private:
+        struct Hopper
+        {
+            AZ::EntityId m_entityId;
+            PhysX::RigidBodyComponent* m_body = nullptr;
+            AZ::TransformInterface* m_transform = nullptr;
+            AZ::TimeMs m_hopPeriodMs = AZ::TimeMs{ 0 };
+            float m_hopForce = 0.0f;
+            uint32_t m_generation = 0;
+        };
+
+        //! A scheduled hop, stale once its hopper is removed or re-added with a new generation.
+        struct WheelEntry
+        {
+            AZ::EntityId m_entityId;
+            uint32_t m_generation = 0;
+            AZ::TimeMs m_dueTimeMs = AZ::TimeMs{ 0 };
+        };
+
+        static constexpr size_t WheelSlotCount = 512;
+        static constexpr AZ::TimeMs WheelSlotMs = AZ::TimeMs{ 10 };
+
+        void Schedule(const Hopper& hopper, AZ::TimeMs dueTimeMs);
+        size_t GetSlotIndex(AZ::TimeMs timeMs) const;
+
+        AZStd::vector<Hopper> m_hoppers;
+        AZStd::unordered_map<AZ::EntityId, size_t> m_hopperIndices;
+        AZStd::array<AZStd::vector<WheelEntry>, WheelSlotCount> m_wheel;
+        AZStd::vector<WheelEntry> m_dueEntries;
+        AZ::TimeMs m_lastTickTimeMs = AZ::TimeMs{ -1 };
+        uint32_t m_nextGeneration = 0;
+    };
+}
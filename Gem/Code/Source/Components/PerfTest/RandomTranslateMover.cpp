@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Components/PerfTest/RandomTranslateMover.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/time.h>
+
+namespace MultiplayerSample
+{
+    template <typename ElementType>
+    static void SwapRemove(AZStd::vector<ElementType>& elements, size_t index)
+    {
+        if (index != elements.size() - 1)
+        {
+            elements[index] = AZStd::move(elements.back());
+        }
+        elements.pop_back();
+    }
+
+    void RandomTranslateMover::AddMover(AZ::EntityId entityId, AZ::TransformInterface& transform, float moveDuration, float maxMoveDistance)
+    {
+        RemoveMover(entityId);
+
+        const AZ::Vector3 position = transform.GetWorldTranslation();
+        m_moverIndices[entityId] = m_entityIds.size();
+        m_entityIds.push_back(entityId);
+        m_transforms.push_back(&transform);
+        m_originalPositions.push_back(position);
+        m_startPositions.push_back(position);
+        m_travelTimes.push_back(0.0f);
+        m_moveDurations.push_back(moveDuration);
+        m_maxMoveDistances.push_back(maxMoveDistance);
+
+        // Mix in the entity id so movers registered in the same millisecond don't all take the same path
+        m_randoms.emplace_back(AZStd::GetTimeUTCMilliSecond() ^ static_cast<AZ::u64>(entityId));
+        m_destinations.push_back(CalculateNextDestination(m_entityIds.size() - 1));
+    }
+
+    void RandomTranslateMover::RemoveMover(AZ::EntityId entityId)
+    {
+        auto indexIter = m_moverIndices.find(entityId);
+        if (indexIter == m_moverIndices.end())
+        {
+            return;
+        }
+
+        const size_t index = indexIter->second;
+        m_moverIndices.erase(indexIter);
+        if (index != m_entityIds.size() - 1)
+        {
+            m_moverIndices[m_entityIds.back()] = index;
+        }
+
+        SwapRemove(m_entityIds, index);
+        SwapRemove(m_transforms, index);
+        SwapRemove(m_originalPositions, index);
+        SwapRemove(m_startPositions, index);
+        SwapRemove(m_destinations, index);
+        SwapRemove(m_travelTimes, index);
+        SwapRemove(m_moveDurations, index);
+        SwapRemove(m_maxMoveDistances, index);
+        SwapRemove(m_randoms, index);
+    }
+
+    void RandomTranslateMover::Tick(float deltaTime)
+    {
+        const size_t moverCount = m_entityIds.size();
+        m_newPositions.resize(moverCount);
+
+        // Interpolation pass, only touches the parallel arrays
+        for (size_t index = 0; index < moverCount; ++index)
+        {
+            m_travelTimes[index] += deltaTime;
+            const float t = (m_moveDurations[index] > 0.0f) ? AZ::GetMin(m_travelTimes[index] / m_moveDurations[index], 1.0f) : 1.0f;
+            m_newPositions[index] = m_startPositions[index].Lerp(m_destinations[index], t);
+        }
+
+        // Write pass, movers that finished their move start the next one from the destination they just reached
+        for (size_t index = 0; index < moverCount; ++index)
+        {
+            m_transforms[index]->SetWorldTranslation(m_newPositions[index]);
+
+            if (m_travelTimes[index] >= m_moveDurations[index])
+            {
+                // Carry the overshoot into the next move so the average speed doesn't depend on the tick rate
+                m_travelTimes[index] -= m_moveDurations[index];
+                m_startPositions[index] = m_destinations[index];
+                m_destinations[index] = CalculateNextDestination(index);
+            }
+        }
+    }
+
+    AZ::Vector3 RandomTranslateMover::CalculateNextDestination(size_t index)
+    {
+        AZ::SimpleLcgRandom& random = m_randoms[index];
+        AZ::Vector3 offset(0.5f - random.GetRandomFloat(), 0.5f - random.GetRandomFloat(), 0.5f - random.GetRandomFloat());
+        offset = m_maxMoveDistances[index] * offset.GetNormalizedEstimate();
+        return m_originalPositions[index] + offset;
+    }
+}
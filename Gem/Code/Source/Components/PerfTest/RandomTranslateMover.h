@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace MultiplayerSample
+{
+    //! @class RandomTranslateMover
+    //! @brief Moves every NetworkRandomTranslateComponent entity between random destinations in one batch per frame.
+    //!
+    //! Movers are stored as parallel arrays so the interpolation of all movers is a single tight loop over contiguous
+    //! data, followed by a separate pass that writes the transforms. Each move interpolates from the position the move
+    //! started at, so every mover lands exactly on its destination when the move duration elapses.
+    class RandomTranslateMover
+    {
+    public:
+        AZ_RTTI(RandomTranslateMover, "{4F8D2B63-7A1E-4C95-B3D6-E0A25C718F94}");
+        virtual ~RandomTranslateMover() = default;
+
+        //! Starts moving an entity around its current position.
+        //! @param moveDuration the number of seconds each move takes
+        //! @param maxMoveDistance the distance from the original position of every destination
+        void AddMover(AZ::EntityId entityId, AZ::TransformInterface& transform, float moveDuration, float maxMoveDistance);
+        void RemoveMover(AZ::EntityId entityId);
+
+        //! Advances every move and writes the new positions.
+        //! Called once per frame by the MultiplayerSampleSystemComponent.
+        void Tick(float deltaTime);
+
+    private:
+        AZ::Vector3 CalculateNextDestination(size_t index);
+
+        AZStd::unordered_map<AZ::EntityId, size_t> m_moverIndices;
+
+        // Parallel arrays, one element per mover
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::TransformInterface*> m_transforms;
+        AZStd::vector<AZ::Vector3> m_originalPositions;
+        AZStd::vector<AZ::Vector3> m_startPositions;
+        AZStd::vector<AZ::Vector3> m_destinations;
+        AZStd::vector<float> m_travelTimes;
+        AZStd::vector<float> m_moveDurations;
+        AZStd::vector<float> m_maxMoveDistances;
+        AZStd::vector<AZ::SimpleLcgRandom> m_randoms;
+
+        //! Positions computed by the interpolation pass, written by the transform pass
+        AZStd::vector<AZ::Vector3> m_newPositions;
+    };
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Components/PerfTest/SpawnPointSampler.h>
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/MathUtils.h>
+#include <LmbrCentral/Shape/BoxShapeComponentBus.h>
+#include <LmbrCentral/Shape/CylinderShapeComponentBus.h>
+#include <LmbrCentral/Shape/SphereShapeComponentBus.h>
+
+namespace MultiplayerSample
+{
+    constexpr size_t PointsPerRefill = 256;
+
+    // Bounds the rejection sampling of a sphere from its enclosing cube, which accepts just over half of the candidates
+    constexpr size_t MaxSphereCandidatesPerPoint = 16;
+
+    static float RadicalInverse(uint64_t index, uint32_t base)
+    {
+        const float invBase = 1.0f / static_cast<float>(base);
+        float fraction = invBase;
+        float result = 0.0f;
+        while (index > 0)
+        {
+            result += static_cast<float>(index % base) * fraction;
+            index /= base;
+            fraction *= invBase;
+        }
+        return result;
+    }
+
+    void SpawnPointSampler::Activate(AZ::EntityId shapeEntityId, SpawnPointDistribution distribution, uint64_t seed)
+    {
+        m_shapeEntityId = shapeEntityId;
+        m_distribution = distribution;
+        m_random.SetSeed(seed);
+
+        // Start every sampler at a different point of the sequence so spawners sharing a shape don't produce the same points
+        constexpr uint64_t MaxHaltonOffset = 1 << 16;
+        m_haltonIndex = seed % MaxHaltonOffset;
+
+        m_points.clear();
+        m_nextPoint = 0;
+        m_snapshotDirty = true;
+        LmbrCentral::ShapeComponentNotificationsBus::Handler::BusConnect(shapeEntityId);
+    }
+
+    void SpawnPointSampler::Deactivate()
+    {
+        LmbrCentral::ShapeComponentNotificationsBus::Handler::BusDisconnect();
+        m_points.clear();
+        m_nextPoint = 0;
+    }
+
+    bool SpawnPointSampler::GetNextPoint(AZ::Vector3& outPoint)
+    {
+        if (m_nextPoint >= m_points.size())
+        {
+            Refill();
+            if (m_points.empty())
+            {
+                return false;
+            }
+        }
+
+        outPoint = m_points[m_nextPoint++];
+        return true;
+    }
+
+    void SpawnPointSampler::OnShapeChanged([[maybe_unused]] LmbrCentral::ShapeComponentNotifications::ShapeChangeReasons changeReason)
+    {
+        // Points already in the buffer were generated for the old shape
+        m_snapshotDirty = true;
+        m_points.clear();
+        m_nextPoint = 0;
+    }
+
+    void SpawnPointSampler::TakeSnapshot()
+    {
+        m_snapshotDirty = false;
+
+        AZ::Crc32 shapeType;
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(shapeType, m_shapeEntityId, &LmbrCentral::ShapeComponentRequests::GetShapeType);
+        AZ::TransformBus::EventResult(m_shapeTransform, m_shapeEntityId, &AZ::TransformBus::Events::GetWorldTM);
+
+        if (shapeType == AZ::Crc32())
+        {
+            m_shapeType = ShapeType::None;
+        }
+        else if (shapeType == AZ_CRC_CE("Box"))
+        {
+            m_shapeType = ShapeType::Box;
+            LmbrCentral::BoxShapeComponentRequestsBus::EventResult(
+                m_boxDimensions, m_shapeEntityId, &LmbrCentral::BoxShapeComponentRequests::GetBoxDimensions);
+        }
+        else if (shapeType == AZ_CRC_CE("Sphere"))
+        {
+            m_shapeType = ShapeType::Sphere;
+            LmbrCentral::SphereShapeComponentRequestsBus::EventResult(
+                m_radius, m_shapeEntityId, &LmbrCentral::SphereShapeComponentRequests::GetRadius);
+        }
+        else if (shapeType == AZ_CRC_CE("Cylinder"))
+        {
+            m_shapeType = ShapeType::Cylinder;
+            LmbrCentral::CylinderShapeComponentRequestsBus::EventResult(
+                m_radius, m_shapeEntityId, &LmbrCentral::CylinderShapeComponentRequests::GetRadius);
+            LmbrCentral::CylinderShapeComponentRequestsBus::EventResult(
+                m_height, m_shapeEntityId, &LmbrCentral::CylinderShapeComponentRequests::GetHeight);
+        }
+        else
+        {
+            m_shapeType = ShapeType::Other;
+        }
+    }
+
+    void SpawnPointSampler::Refill()
+    {
+        if (m_snapshotDirty)
+        {
+            TakeSnapshot();
+        }
+
+        m_points.clear();
+        m_nextPoint = 0;
+        m_points.reserve(PointsPerRefill);
+
+        switch (m_shapeType)
+        {
+        case ShapeType::Box:
+            for (size_t index = 0; index < PointsPerRefill; ++index)
+            {
+                const AZ::Vector3 local = (GetUnitSample() - AZ::Vector3(0.5f)) * m_boxDimensions;
+                m_points.push_back(m_shapeTransform.TransformPoint(local));
+            }
+            break;
+        case ShapeType::Sphere:
+            for (size_t candidate = 0; (candidate < PointsPerRefill * MaxSphereCandidatesPerPoint) && (m_points.size() < PointsPerRefill); ++candidate)
+            {
+                const AZ::Vector3 local = GetUnitSample() * 2.0f - AZ::Vector3(1.0f);
+                if (local.GetLengthSq() <= 1.0f)
+                {
+                    m_points.push_back(m_shapeTransform.TransformPoint(local * m_radius));
+                }
+            }
+            break;
+        case ShapeType::Cylinder:
+            for (size_t index = 0; index < PointsPerRefill; ++index)
+            {
+                // The square root keeps the distribution uniform over the disk area
+                const AZ::Vector3 sample = GetUnitSample();
+                const float radius = m_radius * AZ::Sqrt(sample.GetX());
+                const float angle = AZ::Constants::TwoPi * sample.GetY();
+                const AZ::Vector3 local(radius * AZ::Cos(angle), radius * AZ::Sin(angle), (sample.GetZ() - 0.5f) * m_height);
+                m_points.push_back(m_shapeTransform.TransformPoint(local));
+            }
+            break;
+        case ShapeType::Other:
+            for (size_t index = 0; index < PointsPerRefill; ++index)
+            {
+                AZ::Vector3 point = AZ::Vector3::CreateZero();
+                LmbrCentral::ShapeComponentRequestsBus::EventResult(point, m_shapeEntityId,
+                    &LmbrCentral::ShapeComponentRequests::GenerateRandomPointInside, AZ::RandomDistributionType::UniformReal);
+                m_points.push_back(point);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    AZ::Vector3 SpawnPointSampler::GetUnitSample()
+    {
+        if (m_distribution == SpawnPointDistribution::LowDiscrepancy)
+        {
+            const uint64_t index = ++m_haltonIndex;
+            return AZ::Vector3(RadicalInverse(index, 2), RadicalInverse(index, 3), RadicalInverse(index, 5));
+        }
+
+        return AZ::Vector3(m_random.GetRandomFloat(), m_random.GetRandomFloat(), m_random.GetRandomFloat());
+    }
+}
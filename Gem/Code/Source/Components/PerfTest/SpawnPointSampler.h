@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+#include <LmbrCentral/Shape/ShapeComponentBus.h>
+
+namespace MultiplayerSample
+{
+    enum class SpawnPointDistribution
+    {
+        Uniform,        //!< Independent uniformly distributed points
+        LowDiscrepancy  //!< Halton sequence points, which spread out evenly and rarely land close to each other
+    };
+
+    //! @class SpawnPointSampler
+    //! @brief Generates spawn points inside the shape on an entity in batches.
+    //!
+    //! The geometry of box, sphere and cylinder shapes is read once and cached, then points are generated into a buffer
+    //! without going through the shape bus. The cache is refreshed when the shape reports a change. Other shape types
+    //! fall back to asking the shape for random points, which still happens once per batch rather than once per spawn.
+    class SpawnPointSampler
+        : private LmbrCentral::ShapeComponentNotificationsBus::Handler
+    {
+    public:
+        //! Starts sampling the shape on an entity.
+        //! @param seed seeds the uniform random generator and offsets the start of the low discrepancy sequence
+        void Activate(AZ::EntityId shapeEntityId, SpawnPointDistribution distribution, uint64_t seed);
+        void Deactivate();
+
+        //! Returns the next spawn point, refilling the buffer when it runs out.
+        //! @return false if the entity has no shape to sample
+        bool GetNextPoint(AZ::Vector3& outPoint);
+
+    private:
+        enum class ShapeType
+        {
+            None,
+            Box,
+            Sphere,
+            Cylinder,
+            Other
+        };
+
+        //! ShapeComponentNotificationsBus
+        void OnShapeChanged(LmbrCentral::ShapeComponentNotifications::ShapeChangeReasons changeReason) override;
+
+        void TakeSnapshot();
+        void Refill();
+
+        //! Returns the next point of the unit cube, either uniform random or from the Halton sequence.
+        AZ::Vector3 GetUnitSample();
+
+        AZ::EntityId m_shapeEntityId;
+        SpawnPointDistribution m_distribution = SpawnPointDistribution::LowDiscrepancy;
+        AZ::SimpleLcgRandom m_random;
+        uint64_t m_haltonIndex = 0;
+
+        ShapeType m_shapeType = ShapeType::None;
+        AZ::Transform m_shapeTransform = AZ::Transform::CreateIdentity();
+        AZ::Vector3 m_boxDimensions = AZ::Vector3::CreateZero();
+        float m_radius = 0.0f;
+        float m_height = 0.0f;
+        bool m_snapshotDirty = true;
+
+        AZStd::vector<AZ::Vector3> m_points;
+        size_t m_nextPoint = 0;
+    };
+}
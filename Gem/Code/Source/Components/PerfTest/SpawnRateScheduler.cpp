@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Components/PerfTest/SpawnRateScheduler.h>
+
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+namespace MultiplayerSample
+{
+    static const char* GetShapeName(SpawnRateShape shape)
+    {
+        switch (shape)
+        {
+        case SpawnRateShape::Constant:
+            return "constant";
+        case SpawnRateShape::Ramp:
+            return "ramp";
+        case SpawnRateShape::Burst:
+            return "burst";
+        case SpawnRateShape::Sine:
+            return "sine";
+        }
+        return "unknown";
+    }
+
+    //! Parses a single profile line, returns false if the line isn't a valid segment.
+    static bool ParseSegment(const AZStd::vector<AZStd::string>& tokens, SpawnRateSegment& outSegment)
+    {
+        auto parseFloat = [&tokens](size_t index, float& outValue)
+        {
+            return (index < tokens.size()) && AZ::ConsoleTypeHelpers::StringToValue(outValue, tokens[index]);
+        };
+
+        const AZStd::string& shape = tokens[0];
+        if (!parseFloat(1, outSegment.m_durationSec))
+        {
+            return false;
+        }
+
+        if (shape == "constant")
+        {
+            outSegment.m_shape = SpawnRateShape::Constant;
+            return parseFloat(2, outSegment.m_rate);
+        }
+        if (shape == "ramp")
+        {
+            outSegment.m_shape = SpawnRateShape::Ramp;
+            return parseFloat(2, outSegment.m_rate) && parseFloat(3, outSegment.m_endRate);
+        }
+        if (shape == "burst")
+        {
+            outSegment.m_shape = SpawnRateShape::Burst;
+            return parseFloat(2, outSegment.m_rate) && (tokens.size() > 3)
+                && AZ::ConsoleTypeHelpers::StringToValue(outSegment.m_burstCount, tokens[3]);
+        }
+        if (shape == "sine")
+        {
+            outSegment.m_shape = SpawnRateShape::Sine;
+            return parseFloat(2, outSegment.m_rate) && parseFloat(3, outSegment.m_amplitude) && parseFloat(4, outSegment.m_periodSec)
+                && (outSegment.m_periodSec > 0.0f);
+        }
+        return false;
+    }
+
+    float SpawnRateSegment::GetRate(float segmentTime) const
+    {
+        switch (m_shape)
+        {
+        case SpawnRateShape::Ramp:
+            return (m_durationSec > 0.0f) ? AZ::Lerp(m_rate, m_endRate, AZ::GetClamp(segmentTime / m_durationSec, 0.0f, 1.0f)) : m_rate;
+        case SpawnRateShape::Sine:
+            return m_rate + m_amplitude * AZ::Sin(AZ::Constants::TwoPi * segmentTime / m_periodSec);
+        default:
+            return m_rate;
+        }
+    }
+
+    void SpawnRateScheduler::SetConstantRate(float rate)
+    {
+        m_segments.clear();
+        m_segments.push_back({ SpawnRateShape::Constant, 0.0f, rate });
+        m_profileName = "constant";
+        Reset();
+    }
+
+    bool SpawnRateScheduler::LoadProfile(const char* filePath)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        if ((fileIO == nullptr) || !fileIO->Open(filePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, fileHandle))
+        {
+            AZLOG_ERROR("Failed to open spawn profile %s", filePath);
+            return false;
+        }
+
+        AZ::u64 fileSize = 0;
+        fileIO->Size(fileHandle, fileSize);
+        AZStd::string contents;
+        contents.resize(fileSize);
+        const bool readResult = fileIO->Read(fileHandle, contents.data(), contents.size(), true);
+        fileIO->Close(fileHandle);
+        if (!readResult)
+        {
+            AZLOG_ERROR("Failed to read spawn profile %s", filePath);
+            return false;
+        }
+
+        AZStd::vector<AZStd::string> lines;
+        AZ::StringFunc::Tokenize(contents, lines, "\r\n");
+
+        AZStd::vector<SpawnRateSegment> segments;
+        const AZStd::string* previousLine = nullptr;
+        for (const AZStd::string& line : lines)
+        {
+            AZStd::vector<AZStd::string> tokens;
+            AZ::StringFunc::Tokenize(line, tokens, " \t");
+            if (tokens.empty() || tokens[0].starts_with("#"))
+            {
+                continue;
+            }
+
+            SpawnRateSegment segment;
+            if (!ParseSegment(tokens, segment))
+            {
+                AZLOG_ERROR("Invalid line in spawn profile %s: %s", filePath, line.c_str());
+                return false;
+            }
+
+            // A segment without a positive duration never ends, so any segment after it would never run
+            if (!segments.empty() && (segments.back().m_durationSec <= 0.0f))
+            {
+                AZLOG_ERROR("Only the last segment of spawn profile %s may run forever: %s", filePath, previousLine->c_str());
+                return false;
+            }
+            segments.push_back(segment);
+            previousLine = &line;
+        }
+
+        if (segments.empty())
+        {
+            AZLOG_ERROR("Spawn profile %s has no segments", filePath);
+            return false;
+        }
+
+        m_segments = AZStd::move(segments);
+        m_profileName = filePath;
+        Reset();
+        return true;
+    }
+
+    void SpawnRateScheduler::Reset()
+    {
+        m_stats.clear();
+        m_stats.resize(m_segments.size());
+        m_segmentIndex = 0;
+        m_requestSegmentIndex = 0;
+        m_segmentTime = 0.0f;
+        m_owedSpawns = 0.0;
+        m_burstPending = true;
+    }
+
+    uint32_t SpawnRateScheduler::Advance(float deltaTime, uint32_t maxSpawns)
+    {
+        // A tick can cross several segment boundaries, integrate the rate over each part separately
+        float remainingTime = deltaTime;
+        while ((remainingTime > 0.0f) && !IsFinished())
+        {
+            const SpawnRateSegment& segment = m_segments[m_segmentIndex];
+            SegmentStats& stats = m_stats[m_segmentIndex];
+            m_requestSegmentIndex = m_segmentIndex;
+
+            if (m_burstPending)
+            {
+                m_owedSpawns += segment.m_burstCount;
+                stats.m_requestedSpawns += segment.m_burstCount;
+                m_burstPending = false;
+            }
+
+            const bool endsSegment = (segment.m_durationSec > 0.0f) && (m_segmentTime + remainingTime >= segment.m_durationSec);
+            const float step = endsSegment ? segment.m_durationSec - m_segmentTime : remainingTime;
+
+            // The midpoint rule is exact for constant and linear rates
+            const double requestedSpawns = AZ::GetMax(segment.GetRate(m_segmentTime + step * 0.5f), 0.0f) * static_cast<double>(step);
+            m_owedSpawns += requestedSpawns;
+            stats.m_requestedSpawns += requestedSpawns;
+            stats.m_elapsedSec += step;
+
+            remainingTime -= step;
+            m_segmentTime += step;
+            if (endsSegment)
+            {
+                ++m_segmentIndex;
+                m_segmentTime = 0.0f;
+                m_burstPending = true;
+            }
+        }
+
+        // Keep the fractional remainder, and anything past the per-tick cap, for the next tick
+        const double dueSpawns = AZ::GetMin(AZStd::floor(m_owedSpawns), static_cast<double>(maxSpawns));
+        m_owedSpawns -= dueSpawns;
+        return static_cast<uint32_t>(dueSpawns);
+    }
+
+    size_t SpawnRateScheduler::GetRequestSegmentIndex() const
+    {
+        return m_requestSegmentIndex;
+    }
+
+    void SpawnRateScheduler::RecordSpawns(size_t segmentIndex, uint32_t count)
+    {
+        // Spawns completing after a shorter profile was loaded have no segment to credit
+        if (segmentIndex < m_stats.size())
+        {
+            m_stats[segmentIndex].m_performedSpawns += count;
+        }
+    }
+
+    bool SpawnRateScheduler::IsFinished() const
+    {
+        return m_segmentIndex >= m_segments.size();
+    }
+
+    void SpawnRateScheduler::LogReport(const char* name) const
+    {
+        double totalRequested = 0.0;
+        uint32_t totalPerformed = 0;
+        float totalElapsed = 0.0f;
+
+        AZLOG_INFO("Spawn rate report for %s using profile %s", name, m_profileName.c_str());
+        for (size_t index = 0; index < m_segments.size(); ++index)
+        {
+            const SegmentStats& stats = m_stats[index];
+            if (stats.m_elapsedSec <= 0.0f)
+            {
+                continue;
+            }
+
+            AZLOG_INFO("  segment %zu (%s) %.1f s: requested %.0f spawns (%.2f/s), achieved %u spawns (%.2f/s)",
+                index, GetShapeName(m_segments[index].m_shape), stats.m_elapsedSec, stats.m_requestedSpawns,
+                stats.m_requestedSpawns / stats.m_elapsedSec, stats.m_performedSpawns, stats.m_performedSpawns / stats.m_elapsedSec);
+
+            totalRequested += stats.m_requestedSpawns;
+            totalPerformed += stats.m_performedSpawns;
+            totalElapsed += stats.m_elapsedSec;
+        }
+
+        if (totalElapsed > 0.0f)
+        {
+            AZLOG_INFO("  total %.1f s: requested %.0f spawns (%.2f/s), achieved %u spawns (%.2f/s)",
+                totalElapsed, totalRequested, totalRequested / totalElapsed, totalPerformed, totalPerformed / totalElapsed);
+        }
+    }
+}
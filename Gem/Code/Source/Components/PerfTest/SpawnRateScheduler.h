@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/string.h>
+
+namespace MultiplayerSample
+{
+    //! The shape of the spawn rate over one segment of a spawn profile.
+    enum class SpawnRateShape
+    {
+        Constant, //!< m_rate spawns per second
+        Ramp,     //!< Linear from m_rate to m_endRate spawns per second
+        Burst,    //!< m_burstCount spawns at the start of the segment, then m_rate spawns per second
+        Sine      //!< m_rate spawns per second plus a sine wave of m_amplitude over m_periodSec
+    };
+
+    struct SpawnRateSegment
+    {
+        SpawnRateShape m_shape = SpawnRateShape::Constant;
+        float m_durationSec = 0.0f; //!< Zero or less only for the final segment, which then never ends
+        float m_rate = 0.0f;
+        float m_endRate = 0.0f;
+        float m_amplitude = 0.0f;
+        float m_periodSec = 1.0f;
+        uint32_t m_burstCount = 0;
+
+        //! The spawns requested by this segment, in spawns per second, at a time since the segment started.
+        float GetRate(float segmentTime) const;
+    };
+
+    //! @class SpawnRateScheduler
+    //! @brief Turns a spawn rate profile into a number of spawns per tick.
+    //!
+    //! The fractional part of the spawns owed is carried over between ticks, so the achieved rate matches the requested
+    //! rate at any tick rate, and several spawns are returned in one tick when the rate is higher than the tick rate.
+    //! Every segment tracks the spawns it requested and the spawns actually performed for the end of run report.
+    //!
+    //! Profiles are text files with one segment per line, blank lines and lines starting with # are ignored:
+    //!     constant <durationSec> <rate>
+    //!     ramp <durationSec> <startRate> <endRate>
+    //!     burst <durationSec> <rate> <burstCount>
+    //!     sine <durationSec> <meanRate> <amplitude> <periodSec>
+    class SpawnRateScheduler
+    {
+    public:
+        //! Replaces the profile with a single constant segment that never ends.
+        void SetConstantRate(float rate);
+
+        //! Replaces the profile with the segments of a profile file.
+        //! @return false if the file can't be read, contains an invalid line, or has a segment without a positive duration
+        //!         before its last one. The current profile is kept.
+        bool LoadProfile(const char* filePath);
+
+        //! Restarts the profile from its first segment and clears the statistics.
+        void Reset();
+
+        //! Advances the profile by deltaTime seconds.
+        //! @param maxSpawns the most spawns returned for this tick, spawns past it are carried over to later ticks
+        //! @return the number of spawns due this tick
+        uint32_t Advance(float deltaTime, uint32_t maxSpawns = AZStd::numeric_limits<uint32_t>::max());
+
+        //! The segment the spawns returned by the last Advance are credited to, the last segment that ran during that tick.
+        size_t GetRequestSegmentIndex() const;
+
+        //! Records spawns that completed for a segment, this can be less than requested when the spawner is capped.
+        //! @param segmentIndex the index returned by GetRequestSegmentIndex when the spawns were requested
+        void RecordSpawns(size_t segmentIndex, uint32_t count);
+
+        //! True once the last segment of a profile with a finite duration has elapsed.
+        bool IsFinished() const;
+
+        //! Logs the requested and achieved spawn rates of every segment run so far.
+        void LogReport(const char* name) const;
+
+    private:
+        struct SegmentStats
+        {
+            double m_requestedSpawns = 0.0;
+            uint32_t m_performedSpawns = 0;
+            float m_elapsedSec = 0.0f;
+        };
+
+        AZStd::vector<SpawnRateSegment> m_segments;
+        AZStd::vector<SegmentStats> m_stats;
+        AZStd::string m_profileName = "constant";
+        size_t m_segmentIndex = 0;
+        size_t m_requestSegmentIndex = 0;
+        float m_segmentTime = 0.0f;
+        double m_owedSpawns = 0.0;
+        bool m_burstPending = true;
+    };
+}
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
+#include <Components/SpatialInterestFilterComponent.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(bool, sv_SpatialInterestEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, entities are only replicated to connections whose controlled entity is close enough to them");
+
+    void SpatialInterestFilterComponent::Reflect(AZ::ReflectContext* context)
+    {
+        AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serializeContext)
+        {
+            serializeContext->Class<SpatialInterestFilterComponent, AZ::Component>()
+                ->Field("Enabled", &SpatialInterestFilterComponent::m_enabled)
+                ->Field("Cell Size", &SpatialInterestFilterComponent::m_cellSize)
+                ->Field("Enter Radius", &SpatialInterestFilterComponent::m_enterRadius)
+                ->Field("Exit Radius", &SpatialInterestFilterComponent::m_exitRadius)
+                ->Version(1);
+
+            if (AZ::EditContext* editContext = serializeContext->GetEditContext())
+            {
+                using namespace AZ::Edit;
+                editContext->Class<SpatialInterestFilterComponent>("SpatialInterestFilterComponent",
+                    "Only replicates entities that are close to each connection's controlled entity")
+                    ->ClassElement(ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::Category, "MultiplayerSample")
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Level"))
+                    ->DataElement(nullptr, &SpatialInterestFilterComponent::m_enabled, "Enabled", "enabled if checked")
+                    ->DataElement(nullptr, &SpatialInterestFilterComponent::m_cellSize, "Cell Size",
+                        "the size in meters of a grid cell, interest is only re-evaluated when entities cross cells")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1.0f)
+                    ->DataElement(nullptr, &SpatialInterestFilterComponent::m_enterRadius, "Enter Radius",
+                        "entities closer than this distance to a connection's controlled entity are replicated to that connection")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->DataElement(nullptr, &SpatialInterestFilterComponent::m_exitRadius, "Exit Radius",
+                        "replicated entities stop being replicated once they are further than this distance, should exceed the enter radius by at least a cell")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                ;
+            }
+        }
+    }
+
+    void SpatialInterestFilterComponent::Activate()
+    {
+        m_cellSize = AZ::GetMax(m_cellSize, 1.0f);
+        m_exitRadius = AZ::GetMax(m_exitRadius, m_enterRadius);
+
+        AZ::TickBus::Handler::BusConnect();
+        AZ::EntitySystemBus::Handler::BusConnect();
+        AZ::Interface<IFilterEntityManager>::Register(this);
+    }
+
+    void SpatialInterestFilterComponent::Deactivate()
+    {
+        AZ::Interface<IFilterEntityManager>::Unregister(this);
+        AZ::EntitySystemBus::Handler::BusDisconnect();
+        AZ::TickBus::Handler::BusDisconnect();
+
+        m_connections.clear();
+        m_trackedEntities.clear();
+        m_cells.clear();
+        m_dirtyEntities.clear();
+        m_crossedEntities.clear();
+    }
+
+    bool SpatialInterestFilterComponent::IsEntityFiltered(
+        AZ::Entity* entity,
+        Multiplayer::ConstNetworkEntityHandle controllerEntity,
+        AzNetworking::ConnectionId connectionId)
+    {
+        if (!m_enabled || !sv_SpatialInterestEnabled)
+        {
+            return false;
+        }
+
+        const AZ::Entity* controller = controllerEntity.GetEntity();
+        if ((controller == nullptr) || (controller->GetId() == entity->GetId()))
+        {
+            return false;
+        }
+
+        // Entities without a position are relevant everywhere, and connections controlling one see everything
+        if ((FindOrTrackEntity(*entity) == nullptr) || (FindOrTrackEntity(*controller) == nullptr))
+        {
+            return false;
+        }
+
+        const ConnectionInterest& interest = FindOrAddConnection(connectionId, *controller);
+        return !interest.m_relevantEntities.contains(entity->GetId());
+    }
+
+    void SpatialInterestFilterComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        Update();
+    }
+
+    int SpatialInterestFilterComponent::GetTickOrder()
+    {
+        // Tick before the multiplayer system component so replication windows refresh against current interest
+        return AZ::TICK_PLACEMENT;
+    }
+
+    void SpatialInterestFilterComponent::OnEntityDeactivated(const AZ::EntityId& entityId)
+    {
+        UntrackEntity(entityId);
+    }
+
+    void SpatialInterestFilterComponent::Update()
+    {
+        ++m_updateCount;
+        m_crossedEntities.clear();
+
+        for (const AZ::EntityId& entityId : m_dirtyEntities)
+        {
+            auto entityIter = m_trackedEntities.find(entityId);
+            if (entityIter == m_trackedEntities.end())
+            {
+                continue;
+            }
+
+            TrackedEntity& tracked = entityIter->second;
+            tracked.m_dirty = false;
+            const Cell cell = GetCell(tracked.m_transform->GetWorldTranslation());
+            if (cell == tracked.m_cell)
+            {
+                continue;
+            }
+
+            RemoveFromCell(entityId, tracked.m_cell);
+            InsertIntoCell(entityId, cell);
+            tracked.m_cell = cell;
+            tracked.m_crossedUpdate = m_updateCount;
+            m_crossedEntities.push_back(entityId);
+        }
+        m_dirtyEntities.clear();
+
+        if (m_crossedEntities.empty())
+        {
+            return;
+        }
+
+        for (auto& [connectionId, interest] : m_connections)
+        {
+            const TrackedEntity& controller = m_trackedEntities.find(interest.m_controllerEntityId)->second;
+            if (controller.m_crossedUpdate == m_updateCount)
+            {
+                RebuildConnection(interest);
+                continue;
+            }
+
+            for (const AZ::EntityId& entityId : m_crossedEntities)
+            {
+                UpdateRelevancy(interest, controller.m_cell, entityId, m_trackedEntities.find(entityId)->second.m_cell);
+            }
+        }
+    }
+
+    SpatialInterestFilterComponent::TrackedEntity* SpatialInterestFilterComponent::FindOrTrackEntity(const AZ::Entity& entity)
+    {
+        const AZ::EntityId entityId = entity.GetId();
+        auto entityIter = m_trackedEntities.find(entityId);
+        if (entityIter != m_trackedEntities.end())
+        {
+            return &entityIter->second;
+        }
+
+        AZ::TransformInterface* transform = entity.GetTransform();
+        if (transform == nullptr)
+        {
+            return nullptr;
+        }
+
+        TrackedEntity& tracked = m_trackedEntities[entityId];
+        tracked.m_transform = transform;
+        tracked.m_cell = GetCell(transform->GetWorldTranslation());
+        tracked.m_transformChangedHandler = AZ::TransformChangedEvent::Handler(
+            [this, entityId]([[maybe_unused]] const AZ::Transform& localTm, [[maybe_unused]] const AZ::Transform& worldTm)
+            {
+                auto entityIter = m_trackedEntities.find(entityId);
+                if ((entityIter != m_trackedEntities.end()) && !entityIter->second.m_dirty)
+                {
+                    entityIter->second.m_dirty = true;
+                    m_dirtyEntities.push_back(entityId);
+                }
+            });
+        transform->BindTransformChangedEventHandler(tracked.m_transformChangedHandler);
+        InsertIntoCell(entityId, tracked.m_cell);
+
+        for (auto& [connectionId, interest] : m_connections)
+        {
+            auto controllerIter = m_trackedEntities.find(interest.m_controllerEntityId);
+            if (controllerIter != m_trackedEntities.end())
+            {
+                UpdateRelevancy(interest, controllerIter->second.m_cell, entityId, tracked.m_cell);
+            }
+        }
+
+        return &tracked;
+    }
+
+    void SpatialInterestFilterComponent::UntrackEntity(const AZ::EntityId& entityId)
+    {
+        auto entityIter = m_trackedEntities.find(entityId);
+        if (entityIter == m_trackedEntities.end())
+        {
+            return;
+        }
+
+        RemoveFromCell(entityId, entityIter->second.m_cell);
+        m_trackedEntities.erase(entityIter);
+
+        // Connections that controlled the entity are dropped, they rebuild their interest once filtered with their new controlled entity
+        for (auto connectionIter = m_connections.begin(); connectionIter != m_connections.end();)
+        {
+            if (connectionIter->second.m_controllerEntityId == entityId)
+            {
+                connectionIter = m_connections.erase(connectionIter);
+            }
+            else
+            {
+                connectionIter->second.m_relevantEntities.erase(entityId);
+                ++connectionIter;
+            }
+        }
+    }
+
+    SpatialInterestFilterComponent::ConnectionInterest& SpatialInterestFilterComponent::FindOrAddConnection(
+        AzNetworking::ConnectionId connectionId, const AZ::Entity& controller)
+    {
+        auto connectionIter = m_connections.find(connectionId);
+        if ((connectionIter != m_connections.end()) && (connectionIter->second.m_controllerEntityId == controller.GetId()))
+        {
+            return connectionIter->second;
+        }
+
+        ConnectionInterest& interest = m_connections[connectionId];
+        interest.m_controllerEntityId = controller.GetId();
+        interest.m_relevantEntities.clear();
+        RebuildConnection(interest);
+        return interest;
+    }
+
+    void SpatialInterestFilterComponent::RebuildConnection(ConnectionInterest& interest)
+    {
+        const Cell controllerCell = m_trackedEntities.find(interest.m_controllerEntityId)->second.m_cell;
+        const int32_t cellRange = static_cast<int32_t>(AZStd::ceil(m_exitRadius / m_cellSize));
+
+        AZStd::unordered_set<AZ::EntityId> relevantEntities;
+        for (int32_t cellX = controllerCell.m_x - cellRange; cellX <= controllerCell.m_x + cellRange; ++cellX)
+        {
+            for (int32_t cellY = controllerCell.m_y - cellRange; cellY <= controllerCell.m_y + cellRange; ++cellY)
+            {
+                const Cell cell{ cellX, cellY };
+                auto cellIter = m_cells.find(GetCellKey(cell));
+                if ((cellIter == m_cells.end()) || !IsRelevant(controllerCell, cell, true))
+                {
+                    continue;
+                }
+
+                for (const AZ::EntityId& entityId : cellIter->second)
+                {
+                    if (IsRelevant(controllerCell, cell, interest.m_relevantEntities.contains(entityId)))
+                    {
+                        relevantEntities.insert(entityId);
+                    }
+                }
+            }
+        }
+        interest.m_relevantEntities = AZStd::move(relevantEntities);
+    }
+
+    void SpatialInterestFilterComponent::UpdateRelevancy(
+        ConnectionInterest& interest, const Cell& controllerCell, const AZ::EntityId& entityId, const Cell& entityCell) const
+    {
+        auto relevantIter = interest.m_relevantEntities.find(entityId);
+        const bool wasRelevant = relevantIter != interest.m_relevantEntities.end();
+        const bool isRelevant = IsRelevant(controllerCell, entityCell, wasRelevant);
+        if (wasRelevant && !isRelevant)
+        {
+            interest.m_relevantEntities.erase(relevantIter);
+        }
+        else if (!wasRelevant && isRelevant)
+        {
+            interest.m_relevantEntities.insert(entityId);
+        }
+    }
+
+    bool SpatialInterestFilterComponent::IsRelevant(const Cell& controllerCell, const Cell& entityCell, bool wasRelevant) const
+    {
+        const float deltaX = static_cast<float>(entityCell.m_x - controllerCell.m_x) * m_cellSize;
+        const float deltaY = static_cast<float>(entityCell.m_y - controllerCell.m_y) * m_cellSize;
+        const float radius = wasRelevant ? m_exitRadius : m_enterRadius;
+        return (deltaX * deltaX + deltaY * deltaY) <= radius * radius;
+    }
+
+    SpatialInterestFilterComponent::Cell SpatialInterestFilterComponent::GetCell(const AZ::Vector3& position) const
+    {
+        return Cell{ static_cast<int32_t>(AZStd::floor(position.GetX() / m_cellSize)),
+            static_cast<int32_t>(AZStd::floor(position.GetY() / m_cellSize)) };
+    }
+
+    SpatialInterestFilterComponent::CellKey SpatialInterestFilterComponent::GetCellKey(const Cell& cell) const
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(cell.m_x)) << 32) | static_cast<uint32_t>(cell.m_y);
+    }
+
+    void SpatialInterestFilterComponent::InsertIntoCell(const AZ::EntityId& entityId, const Cell& cell)
+    {
+        m_cells[GetCellKey(cell)].push_back(entityId);
+    }
+
+    void SpatialInterestFilterComponent::RemoveFromCell(const AZ::EntityId& entityId, const Cell& cell)
+    {
+        auto cellIter = m_cells.find(GetCellKey(cell));
+        if (cellIter == m_cells.end())
+        {
+            return;
+        }
+
+        AZStd::vector<AZ::EntityId>& entityIds = cellIter->second;
+        auto entityIter = AZStd::find(entityIds.begin(), entityIds.end(), entityId);
+        if (entityIter != entityIds.end())
+        {
+            *entityIter = entityIds.back();
+            entityIds.pop_back();
+        }
+        if (entityIds.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+}
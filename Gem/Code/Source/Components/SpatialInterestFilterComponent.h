@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
+
+namespace MultiplayerSample
+{
+    //! @class SpatialInterestFilterComponent
+    //! @brief Uses IFilterEntityManager to only replicate entities near each connection's controlled entity.
+    //!
+    //! Filtered entities are bucketed in a uniform grid on the XY plane, and each connection caches the set of entities
+    //! it is interested in. Distances are measured between cell centers, so interest only changes when an entity or a
+    //! controlled entity crosses into another cell: a tick re-evaluates the entities that crossed cells against every
+    //! connection, and fully rebuilds the sets of the connections whose controlled entity crossed cells.
+    //!
+    //! Entities become relevant within the enter radius and stay relevant until they are beyond the exit radius,
+    //! so entities moving along the boundary don't flicker in and out of the replication window.
+    //!
+    //! Only one IFilterEntityManager can be registered, so a level uses either this component or ExampleFilteredEntityComponent.
+    class SpatialInterestFilterComponent final
+        : public AZ::Component
+        , public Multiplayer::IFilterEntityManager
+        , private AZ::TickBus::Handler
+        , private AZ::EntitySystemBus::Handler
+    {
+    public:
+        AZ_COMPONENT(MultiplayerSample::SpatialInterestFilterComponent, "{B2E7C4A9-3F61-4D8B-9A05-7C1E6D3F8B24}", Multiplayer::IFilterEntityManager);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! AZ::Component overrides.
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! }@
+
+        //! IFilterEntityManager overrides.
+        //! @{
+        bool IsEntityFiltered(AZ::Entity* entity, Multiplayer::ConstNetworkEntityHandle controllerEntity, AzNetworking::ConnectionId connectionId) override;
+        //! }@
+
+    private:
+        struct Cell
+        {
+            int32_t m_x = 0;
+            int32_t m_y = 0;
+
+            bool operator==(const Cell& rhs) const
+            {
+                return (m_x == rhs.m_x) && (m_y == rhs.m_y);
+            }
+        };
+        using CellKey = uint64_t;
+
+        struct TrackedEntity
+        {
+            AZ::TransformInterface* m_transform = nullptr;
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+            Cell m_cell;
+            uint32_t m_crossedUpdate = 0;
+            bool m_dirty = false;
+        };
+
+        struct ConnectionInterest
+        {
+            AZ::EntityId m_controllerEntityId;
+            AZStd::unordered_set<AZ::EntityId> m_relevantEntities;
+        };
+
+        //! AZ::TickBus overrides.
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! }@
+
+        //! AZ::EntitySystemBus overrides.
+        //! @{
+        void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+        //! }@
+
+        //! Moves the entities that changed cells since the last update and updates the interest of every connection.
+        void Update();
+
+        TrackedEntity* FindOrTrackEntity(const AZ::Entity& entity);
+        void UntrackEntity(const AZ::EntityId& entityId);
+        ConnectionInterest& FindOrAddConnection(AzNetworking::ConnectionId connectionId, const AZ::Entity& controller);
+
+        //! Rebuilds the relevant set of a connection from the cells within the exit radius of its controlled entity.
+        void RebuildConnection(ConnectionInterest& interest);
+
+        //! Adds or removes an entity from the relevant set of a connection based on their cell distance.
+        void UpdateRelevancy(ConnectionInterest& interest, const Cell& controllerCell, const AZ::EntityId& entityId, const Cell& entityCell) const;
+        bool IsRelevant(const Cell& controllerCell, const Cell& entityCell, bool wasRelevant) const;
+
+        Cell GetCell(const AZ::Vector3& position) const;
+        CellKey GetCellKey(const Cell& cell) const;
+        void InsertIntoCell(const AZ::EntityId& entityId, const Cell& cell);
+        void RemoveFromCell(const AZ::EntityId& entityId, const Cell& cell);
+
+        bool m_enabled = true;
+        float m_cellSize = 16.0f;
+        float m_enterRadius = 64.0f;
+        float m_exitRadius = 80.0f;
+
+        AZStd::unordered_map<AZ::EntityId, TrackedEntity> m_trackedEntities;
+        AZStd::unordered_map<CellKey, AZStd::vector<AZ::EntityId>> m_cells;
+        AZStd::vector<AZ::EntityId> m_dirtyEntities;
+        AZStd::vector<AZ::EntityId> m_crossedEntities;
+        AZStd::unordered_map<AzNetworking::ConnectionId, ConnectionInterest> m_connections;
+        uint32_t m_updateCount = 0;
+    };
+}
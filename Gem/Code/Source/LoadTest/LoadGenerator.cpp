@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/LoadTest/LoadGenerator.h>
+
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzFramework/Process/ProcessWatcher.h>
+#include <Source/LoadTest/PerfTelemetry.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(bool, cl_BotClient, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If enabled, the autonomous player is driven by the AI instead of device input");
+    AZ_CVAR(AZ::CVarFixedString, mps_BotClientExecutable, "MultiplayerSample.GameLauncher", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The client launcher used for bot clients, relative to the directory of the running executable");
+    AZ_CVAR(AZ::CVarFixedString, mps_BotClientArguments, "--console-command-file=launch_client.cfg --rhi=null --cl_BotClient=true", nullptr,
+        AZ::ConsoleFunctorFlags::DontReplicate, "The command line used to start a bot client");
+    AZ_CVAR(bool, mps_LoadReport, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If enabled, periodically logs frame time, connection bandwidth and correction rates, always enabled while bot clients are running");
+    AZ_CVAR(float, mps_LoadReportIntervalSec, 5.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of seconds between load reports");
+
+    static void mps_LaunchBotClients(const AZ::ConsoleCommandContainer& arguments)
+    {
+        LoadGenerator* loadGenerator = AZ::Interface<LoadGenerator>::Get();
+        if (loadGenerator == nullptr)
+        {
+            return;
+        }
+
+        uint32_t count = 1;
+        if (!arguments.empty())
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(count, arguments.front());
+        }
+        loadGenerator->LaunchBotClients(count);
+    }
+    AZ_CONSOLEFREEFUNC(mps_LaunchBotClients, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Launches headless bot clients which connect to the local server, optional argument is the number of bot clients");
+
+    static void mps_StopBotClients([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (LoadGenerator* loadGenerator = AZ::Interface<LoadGenerator>::Get())
+        {
+            loadGenerator->StopBotClients();
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mps_StopBotClients, AZ::ConsoleFunctorFlags::DontReplicate, "Terminates all bot clients launched by this process");
+
+    LoadGenerator::LoadGenerator() = default;
+
+    LoadGenerator::~LoadGenerator()
+    {
+        StopBotClients();
+    }
+
+    bool LoadGenerator::IsBotClient() const
+    {
+        return cl_BotClient;
+    }
+
+    void LoadGenerator::LaunchBotClients(uint32_t count)
+    {
+        const AZ::IO::FixedMaxPath executablePath =
+            AZ::IO::FixedMaxPath(AZ::Utils::GetExecutableDirectory()) / static_cast<AZ::CVarFixedString>(mps_BotClientExecutable).c_str();
+
+        AzFramework::ProcessLauncher::ProcessLaunchInfo launchInfo;
+        launchInfo.m_processExecutableString = executablePath.c_str();
+        launchInfo.m_commandlineParameters = AZStd::string(static_cast<AZ::CVarFixedString>(mps_BotClientArguments).c_str());
+        launchInfo.m_workingDirectory = AZ::Utils::GetProjectPath().c_str();
+        launchInfo.m_showWindow = false;
+
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            AZStd::unique_ptr<AzFramework::ProcessWatcher> botClient(
+                AzFramework::ProcessWatcher::LaunchProcess(launchInfo, AzFramework::ProcessCommunicationType::COMMUNICATOR_TYPE_NONE));
+            if (botClient == nullptr)
+            {
+                AZLOG_ERROR("Failed to launch bot client %s", executablePath.c_str());
+                break;
+            }
+            m_botClients.push_back(AZStd::move(botClient));
+        }
+
+        AZLOG_INFO("Launched bot clients, %zu running", m_botClients.size());
+    }
+
+    void LoadGenerator::StopBotClients()
+    {
+        for (AZStd::unique_ptr<AzFramework::ProcessWatcher>& botClient : m_botClients)
+        {
+            if (botClient->IsProcessRunning())
+            {
+                botClient->TerminateProcess(0);
+            }
+        }
+        m_botClients.clear();
+    }
+
+    void LoadGenerator::RecordReprocessedInput()
+    {
+        ++m_reprocessedInputs;
+    }
+
+    void LoadGenerator::Tick(float deltaTime)
+    {
+        if (IsReportEnabled())
+        {
+            // The tick time of the previous frame, this frame's handlers are still running
+            const float tickMs = AZ::Interface<PerfTelemetry>::Get()->GetLastTickMs();
+            m_timeSinceReport += deltaTime;
+            m_maxFrameTime = AZ::GetMax(m_maxFrameTime, deltaTime);
+            m_totalTickMs += tickMs;
+            m_maxTickMs = AZ::GetMax(m_maxTickMs, tickMs);
+            ++m_frameCount;
+
+            if (m_timeSinceReport < mps_LoadReportIntervalSec)
+            {
+                return;
+            }
+            Report(m_timeSinceReport);
+        }
+
+        m_timeSinceReport = 0.0f;
+        m_maxFrameTime = 0.0f;
+        m_totalTickMs = 0.0f;
+        m_maxTickMs = 0.0f;
+        m_frameCount = 0;
+        m_reprocessedInputs = 0;
+    }
+
+    bool LoadGenerator::IsReportEnabled() const
+    {
+        return mps_LoadReport || cl_BotClient || !m_botClients.empty();
+    }
+
+    void LoadGenerator::Report(float elapsedSeconds)
+    {
+        ConnectionMetricsSummary connections;
+        SummarizeConnectionMetrics(connections);
+        const float averageFrameMs = (m_frameCount > 0) ? (elapsedSeconds * 1000.0f) / m_frameCount : 0.0f;
+        const float averageTickMs = (m_frameCount > 0) ? m_totalTickMs / m_frameCount : 0.0f;
+        const float connectionScale = (connections.m_connectionCount > 0) ? 1.0f / connections.m_connectionCount : 0.0f;
+
+        if (cl_BotClient)
+        {
+            AZLOG_INFO("Bot client load report: frame %.2f ms avg %.2f ms max, send %.0f B/s, recv %.0f B/s, loss %.1f%%, %.1f reprocessed inputs/s",
+                averageFrameMs, m_maxFrameTime * 1000.0f, connections.m_totalSendBytesPerSecond, connections.m_totalRecvBytesPerSecond,
+                connections.m_maxLossPercent, m_reprocessedInputs / elapsedSeconds);
+        }
+        else
+        {
+            AZLOG_INFO("Server load report: %zu bot clients, %u connections, tick %.2f ms avg %.2f ms max, frame %.2f ms avg %.2f ms max, "
+                "send %.0f B/s per connection (%.0f max), recv %.0f B/s per connection, worst loss %.1f%%",
+                m_botClients.size(), connections.m_connectionCount, averageTickMs, m_maxTickMs, averageFrameMs, m_maxFrameTime * 1000.0f,
+                connections.m_totalSendBytesPerSecond * connectionScale, connections.m_maxSendBytesPerSecond,
+                connections.m_totalRecvBytesPerSecond * connectionScale, connections.m_maxLossPercent);
+        }
+    }
+}
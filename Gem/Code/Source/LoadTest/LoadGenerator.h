@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzFramework
+{
+    class ProcessWatcher;
+}
+
+namespace MultiplayerSample
+{
+    //! @class LoadGenerator
+    //! @brief Launches headless bot clients against a local server and reports how the server copes as they join.
+    //!
+    //! Each bot client is a separate null renderer client process which connects to the server over loopback,
+    //! so the server handles real connections, input packets, corrections and per-connection replication.
+    //! Bot clients drive their autonomous player from the same AI logic used by server side AI characters.
+    //!
+    //! While bots are running, the server logs its tick time as measured by PerfTelemetry next to the number of bot
+    //! clients, along with its frame time and the bandwidth of every connection. Each bot client logs its own frame
+    //! time, bandwidth and how many inputs it had to reprocess after corrections.
+    class LoadGenerator
+    {
+    public:
+        AZ_RTTI(LoadGenerator, "{8D4A2C71-5B3E-4F09-A6E2-1C7D9B3F0E54}");
+        LoadGenerator();
+        virtual ~LoadGenerator();
+
+        //! Returns true if this process is a bot client whose autonomous player is driven by the AI.
+        bool IsBotClient() const;
+
+        //! Launches bot client processes which connect to the server over loopback.
+        //! @param count the number of bot clients to add to the ones already running
+        void LaunchBotClients(uint32_t count);
+
+        //! Terminates all bot client processes launched by this process.
+        void StopBotClients();
+
+        //! Records an input reprocessed by the autonomous player after a correction from the server.
+        void RecordReprocessedInput();
+
+        //! Accumulates frame timings and logs a load report at the configured interval.
+        //! @param deltaTime the time in seconds since the last tick
+        void Tick(float deltaTime);
+
+    private:
+        bool IsReportEnabled() const;
+        void Report(float elapsedSeconds);
+
+        AZStd::vector<AZStd::unique_ptr<AzFramework::ProcessWatcher>> m_botClients;
+        float m_timeSinceReport = 0.0f;
+        float m_maxFrameTime = 0.0f;
+        float m_totalTickMs = 0.0f;
+        float m_maxTickMs = 0.0f;
+        uint32_t m_frameCount = 0;
+        uint32_t m_reprocessedInputs = 0;
+    };
+}
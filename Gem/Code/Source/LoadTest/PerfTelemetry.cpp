@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/LoadTest/PerfTelemetry.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/sort.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/ConnectionLayer/IConnectionSet.h>
+#include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzNetworking/Framework/INetworking.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/MultiplayerConstants.h>
+#include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(AZ::CVarFixedString, mps_TelemetryFile, "@user@/ServerTelemetry.csv", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The default file written by mps_TelemetryStart");
+    AZ_CVAR(uint32_t, mps_TelemetryFlushIntervalMs, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "How often buffered telemetry samples are written to the capture file");
+
+    static void mps_TelemetryStart(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (PerfTelemetry* telemetry = AZ::Interface<PerfTelemetry>::Get())
+        {
+            const AZ::CVarFixedString filePath = arguments.empty() ? AZ::CVarFixedString() : AZ::CVarFixedString(arguments.front());
+            telemetry->StartCapture(filePath.empty() ? nullptr : filePath.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mps_TelemetryStart, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Starts capturing per-tick server performance samples, optional argument is the output file");
+
+    static void mps_TelemetryStop([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (PerfTelemetry* telemetry = AZ::Interface<PerfTelemetry>::Get())
+        {
+            telemetry->StopCapture();
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mps_TelemetryStop, AZ::ConsoleFunctorFlags::DontReplicate, "Stops the telemetry capture and logs its percentile summary");
+
+    constexpr const char* SectionNames[] = { "input_ms", "gathers_ms", "animation_ms" };
+    static_assert(AZ_ARRAY_SIZE(SectionNames) == static_cast<size_t>(PerfSection::Count), "A name is required for every PerfSection");
+
+    //! Sorts the rates and returns their min, p95 and max, all 0 without any rate.
+    static void GetRateSpread(AZStd::vector<float>& rates, float& outMin, float& outP95, float& outMax)
+    {
+        if (rates.empty())
+        {
+            outMin = outP95 = outMax = 0.0f;
+            return;
+        }
+
+        AZStd::sort(rates.begin(), rates.end());
+        outMin = rates.front();
+        outP95 = rates[aznumeric_cast<size_t>(0.95f * (rates.size() - 1))];
+        outMax = rates.back();
+    }
+
+    void SummarizeConnectionMetrics(ConnectionMetricsSummary& outSummary)
+    {
+        outSummary.m_connectionCount = 0;
+        outSummary.m_totalSendBytesPerSecond = 0.0f;
+        outSummary.m_totalRecvBytesPerSecond = 0.0f;
+        outSummary.m_maxLossPercent = 0.0f;
+        outSummary.m_sendBytesPerSecond.clear();
+        outSummary.m_recvBytesPerSecond.clear();
+
+        AzNetworking::INetworkInterface* networkInterface =
+            AZ::Interface<AzNetworking::INetworking>::Get()->RetrieveNetworkInterface(AZ::Name(Multiplayer::MpNetworkInterfaceName));
+        if (networkInterface != nullptr)
+        {
+            networkInterface->GetConnectionSet().VisitConnections([&outSummary](AzNetworking::IConnection& connection)
+            {
+                const AzNetworking::ConnectionMetrics& metrics = connection.GetMetrics();
+                const float sendBytesPerSecond = metrics.m_sendDatarate.GetBytesPerSecond();
+                const float recvBytesPerSecond = metrics.m_recvDatarate.GetBytesPerSecond();
+                ++outSummary.m_connectionCount;
+                outSummary.m_totalSendBytesPerSecond += sendBytesPerSecond;
+                outSummary.m_totalRecvBytesPerSecond += recvBytesPerSecond;
+                outSummary.m_sendBytesPerSecond.push_back(sendBytesPerSecond);
+                outSummary.m_recvBytesPerSecond.push_back(recvBytesPerSecond);
+                outSummary.m_maxLossPercent = AZ::GetMax(outSummary.m_maxLossPercent, metrics.m_sendDatarate.GetLossRatePercent());
+            });
+        }
+
+        GetRateSpread(outSummary.m_sendBytesPerSecond,
+            outSummary.m_minSendBytesPerSecond, outSummary.m_p95SendBytesPerSecond, outSummary.m_maxSendBytesPerSecond);
+        GetRateSpread(outSummary.m_recvBytesPerSecond,
+            outSummary.m_minRecvBytesPerSecond, outSummary.m_p95RecvBytesPerSecond, outSummary.m_maxRecvBytesPerSecond);
+    }
+
+    PerfTelemetry::TickBoundary::TickBoundary(PerfTelemetry& telemetry, int tickOrder)
+        : m_telemetry(telemetry)
+        , m_tickOrder(tickOrder)
+    {
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    PerfTelemetry::TickBoundary::~TickBoundary()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    void PerfTelemetry::TickBoundary::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        const AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
+        if (m_tickOrder == AZ::TICK_FIRST)
+        {
+            m_telemetry.m_tickStart = now;
+        }
+        else
+        {
+            const AZStd::chrono::duration<float, AZStd::milli> elapsed = now - m_telemetry.m_tickStart;
+            m_telemetry.m_lastTickMs = elapsed.count();
+        }
+    }
+
+    int PerfTelemetry::TickBoundary::GetTickOrder()
+    {
+        return m_tickOrder;
+    }
+
+    PerfTelemetry::PerfTelemetry()
+        : m_tickStart(AZStd::chrono::steady_clock::now())
+    {
+    }
+
+    PerfTelemetry::~PerfTelemetry()
+    {
+        StopCapture();
+    }
+
+    void PerfTelemetry::StartCapture(const char* filePath)
+    {
+        StopCapture();
+
+        const AZ::CVarFixedString defaultFilePath = mps_TelemetryFile;
+        if (filePath == nullptr)
+        {
+            filePath = defaultFilePath.c_str();
+        }
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if ((fileIO == nullptr) || !fileIO->Open(filePath, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeText, m_fileHandle))
+        {
+            AZLOG_ERROR("Failed to open telemetry capture file %s", filePath);
+            m_fileHandle = AZ::IO::InvalidHandle;
+            return;
+        }
+
+        m_pendingRows = "time_s,frame_ms,tick_ms";
+        for (const char* sectionName : SectionNames)
+        {
+            m_pendingRows += ',';
+            m_pendingRows += sectionName;
+        }
+        m_pendingRows += ",entities,connections,send_bytes_per_sec_per_connection,recv_bytes_per_sec_per_connection"
+            ",send_bytes_per_sec_min,send_bytes_per_sec_p95,send_bytes_per_sec_max"
+            ",recv_bytes_per_sec_min,recv_bytes_per_sec_p95,recv_bytes_per_sec_max\n";
+
+        m_tickSectionMs = {};
+        m_captureTime = 0.0f;
+        m_timeSinceFlush = 0.0f;
+        AZLOG_INFO("Started telemetry capture to %s", filePath);
+    }
+
+    void PerfTelemetry::StopCapture()
+    {
+        if (!IsCapturing())
+        {
+            return;
+        }
+
+        Flush();
+        AZ::IO::FileIOBase::GetInstance()->Close(m_fileHandle);
+        m_fileHandle = AZ::IO::InvalidHandle;
+
+        LogSummary();
+        m_frameMsSamples.clear();
+        m_tickMsSamples.clear();
+        for (AZStd::vector<float>& sectionSamples : m_sectionMsSamples)
+        {
+            sectionSamples.clear();
+        }
+    }
+
+    bool PerfTelemetry::IsCapturing() const
+    {
+        return m_fileHandle != AZ::IO::InvalidHandle;
+    }
+
+    void PerfTelemetry::AddSectionTime(PerfSection section, float milliseconds)
+    {
+        m_tickSectionMs[static_cast<size_t>(section)] += milliseconds;
+    }
+
+    void PerfTelemetry::Tick(float deltaTime)
+    {
+        if (!IsCapturing())
+        {
+            return;
+        }
+
+        const float frameMs = deltaTime * 1000.0f;
+        m_captureTime += deltaTime;
+        m_frameMsSamples.push_back(frameMs);
+        m_tickMsSamples.push_back(m_lastTickMs);
+
+        const Multiplayer::INetworkEntityManager* networkEntityManager = Multiplayer::GetNetworkEntityManager();
+        const uint32_t entityCount = (networkEntityManager != nullptr) ? networkEntityManager->GetEntityCount() : 0;
+        SummarizeConnectionMetrics(m_connections);
+        const ConnectionMetricsSummary& connections = m_connections;
+        const float connectionScale = (connections.m_connectionCount > 0) ? 1.0f / connections.m_connectionCount : 0.0f;
+
+        m_pendingRows += AZStd::string::format("%.3f,%.3f,%.3f", m_captureTime, frameMs, m_lastTickMs);
+        for (size_t section = 0; section < m_tickSectionMs.size(); ++section)
+        {
+            m_pendingRows += AZStd::string::format(",%.3f", m_tickSectionMs[section]);
+            m_sectionMsSamples[section].push_back(m_tickSectionMs[section]);
+        }
+        m_pendingRows += AZStd::string::format(",%u,%u,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f\n", entityCount, connections.m_connectionCount,
+            connections.m_totalSendBytesPerSecond * connectionScale, connections.m_totalRecvBytesPerSecond * connectionScale,
+            connections.m_minSendBytesPerSecond, connections.m_p95SendBytesPerSecond, connections.m_maxSendBytesPerSecond,
+            connections.m_minRecvBytesPerSecond, connections.m_p95RecvBytesPerSecond, connections.m_maxRecvBytesPerSecond);
+        m_tickSectionMs = {};
+
+        m_timeSinceFlush += deltaTime;
+        if (m_timeSinceFlush * 1000.0f >= mps_TelemetryFlushIntervalMs)
+        {
+            Flush();
+            m_timeSinceFlush = 0.0f;
+        }
+    }
+
+    float PerfTelemetry::GetLastTickMs() const
+    {
+        return m_lastTickMs;
+    }
+
+    void PerfTelemetry::Flush()
+    {
+        if (!m_pendingRows.empty())
+        {
+            AZ::IO::FileIOBase::GetInstance()->Write(m_fileHandle, m_pendingRows.data(), m_pendingRows.size());
+            m_pendingRows.clear();
+        }
+    }
+
+    void PerfTelemetry::LogSummary()
+    {
+        auto logPercentiles = [](const char* name, AZStd::vector<float>& samples)
+        {
+            if (samples.empty())
+            {
+                return;
+            }
+
+            AZStd::sort(samples.begin(), samples.end());
+            auto percentile = [&samples](float fraction)
+            {
+                return samples[aznumeric_cast<size_t>(fraction * (samples.size() - 1))];
+            };
+            AZLOG_INFO("  %-14s p50 %8.3f  p90 %8.3f  p99 %8.3f  max %8.3f",
+                name, percentile(0.5f), percentile(0.9f), percentile(0.99f), samples.back());
+        };
+
+        AZLOG_INFO("Telemetry summary over %zu ticks (%.1f s):", m_frameMsSamples.size(), m_captureTime);
+        logPercentiles("frame_ms", m_frameMsSamples);
+        logPercentiles("tick_ms", m_tickMsSamples);
+        for (size_t section = 0; section < m_sectionMsSamples.size(); ++section)
+        {
+            logPercentiles(SectionNames[section], m_sectionMsSamples[section]);
+        }
+    }
+
+    ScopedPerfSection::ScopedPerfSection(PerfSection section)
+        : m_section(section)
+    {
+        PerfTelemetry* telemetry = AZ::Interface<PerfTelemetry>::Get();
+        if ((telemetry != nullptr) && telemetry->IsCapturing())
+        {
+            m_telemetry = telemetry;
+            m_start = AZStd::chrono::steady_clock::now();
+        }
+    }
+
+    ScopedPerfSection::~ScopedPerfSection()
+    {
+        if (m_telemetry != nullptr)
+        {
+            const AZStd::chrono::duration<float, AZStd::milli> elapsed = AZStd::chrono::steady_clock::now() - m_start;
+            m_telemetry->AddSectionTime(m_section, elapsed.count());
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace MultiplayerSample
+{
+    //! Bandwidth of the connections on the multiplayer network interface, averaged over the connection metrics window.
+    //! The min, p95 and max rates are taken over connections, so one starved or flooded connection stands out of the total.
+    struct ConnectionMetricsSummary
+    {
+        uint32_t m_connectionCount = 0;
+        float m_totalSendBytesPerSecond = 0.0f;
+        float m_totalRecvBytesPerSecond = 0.0f;
+        float m_minSendBytesPerSecond = 0.0f;
+        float m_p95SendBytesPerSecond = 0.0f;
+        float m_maxSendBytesPerSecond = 0.0f;
+        float m_minRecvBytesPerSecond = 0.0f;
+        float m_p95RecvBytesPerSecond = 0.0f;
+        float m_maxRecvBytesPerSecond = 0.0f;
+        float m_maxLossPercent = 0.0f;
+
+        //! The rate of each connection, sorted, kept so that summarizing again reuses their storage
+        AZStd::vector<float> m_sendBytesPerSecond;
+        AZStd::vector<float> m_recvBytesPerSecond;
+    };
+
+    //! Summarizes the metrics of every connection on the multiplayer network interface into outSummary.
+    void SummarizeConnectionMetrics(ConnectionMetricsSummary& outSummary);
+
+    //! Parts of the server frame timed by the PerfTelemetry capture.
+    enum class PerfSection
+    {
+        InputProcessing,
+        WeaponGathers,
+        Animation,
+        Count
+    };
+
+    //! @class PerfTelemetry
+    //! @brief Captures per-tick server performance samples to a CSV file.
+    //!
+    //! Each tick records the frame time, the tick time, the time spent in the instrumented sections, the network
+    //! entity count, and the average, min, p95 and max bandwidth over connections. Rows are buffered and written at a configurable interval,
+    //! and percentile summaries of the timings are logged when the capture stops, including on shutdown.
+    //! Sections are timed with ScopedPerfSection and must only be entered from the main thread.
+    //!
+    //! The tick time is measured on every frame, captured or not, from the first to the last TickBus handler. Unlike the
+    //! frame time it excludes the time a frame limited server sleeps between ticks, so it shows how close the server is
+    //! to missing its tick rate.
+    class PerfTelemetry
+    {
+    public:
+        AZ_RTTI(PerfTelemetry, "{C2E7A94B-61D8-4F3A-B5C0-7E19D4A2F863}");
+        PerfTelemetry();
+        virtual ~PerfTelemetry();
+
+        //! Starts writing samples to the provided file, stopping any capture in progress.
+        //! @param filePath the output file, file IO aliases such as @user@ are supported; uses mps_TelemetryFile if null
+        void StartCapture(const char* filePath = nullptr);
+
+        //! Flushes the remaining samples, closes the file and logs the percentile summary.
+        void StopCapture();
+
+        bool IsCapturing() const;
+
+        //! Adds time spent in a section to the current tick.
+        void AddSectionTime(PerfSection section, float milliseconds);
+
+        //! Completes the sample for this tick.
+        //! @param deltaTime the time in seconds since the last tick
+        void Tick(float deltaTime);
+
+        //! Returns the time in milliseconds the TickBus handlers took on the last completed frame.
+        float GetLastTickMs() const;
+
+    private:
+        //! Marks the start or the end of the TickBus handlers of a frame.
+        class TickBoundary
+            : public AZ::TickBus::Handler
+        {
+        public:
+            TickBoundary(PerfTelemetry& telemetry, int tickOrder);
+            ~TickBoundary() override;
+
+            void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+            int GetTickOrder() override;
+
+        private:
+            PerfTelemetry& m_telemetry;
+            int m_tickOrder;
+        };
+
+        void Flush();
+        void LogSummary();
+
+        using SectionTimes = AZStd::array<float, static_cast<size_t>(PerfSection::Count)>;
+
+        AZ::IO::HandleType m_fileHandle = AZ::IO::InvalidHandle;
+        AZStd::string m_pendingRows;
+        SectionTimes m_tickSectionMs = {};
+        AZStd::vector<float> m_frameMsSamples;
+        AZStd::array<AZStd::vector<float>, static_cast<size_t>(PerfSection::Count)> m_sectionMsSamples;
+        AZStd::vector<float> m_tickMsSamples;
+        ConnectionMetricsSummary m_connections;
+        float m_captureTime = 0.0f;
+        float m_timeSinceFlush = 0.0f;
+
+        AZStd::chrono::steady_clock::time_point m_tickStart;
+        float m_lastTickMs = 0.0f;
+        TickBoundary m_tickStartBoundary{ *this, AZ::TICK_FIRST };
+        TickBoundary m_tickEndBoundary{ *this, AZ::TICK_LAST };
+    };
+
+    //! Times the enclosing scope and adds it to a PerfTelemetry section, does nothing when no capture is running.
+    class ScopedPerfSection
+    {
+    public:
+        explicit ScopedPerfSection(PerfSection section);
+        ~ScopedPerfSection();
+
+    private:
+        PerfTelemetry* m_telemetry = nullptr;
+        PerfSection m_section;
+        AZStd::chrono::steady_clock::time_point m_start;
+    };
+}
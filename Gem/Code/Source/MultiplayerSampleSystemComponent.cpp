@@ -16,7 +16,7 @@
 #include <Source/Weapons/WeaponTypes.h>
 #include <Source/Components/NetworkStressTestComponent.h>
 #include <Source/Components/NetworkAiComponent.h>
-#include <Source/Spawners/RoundRobinSpawner.h>
+#include <Source/Spawners/OccupancyAwareSpawner.h>
 
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/Components/NetBindComponent.h>
@@ -86,12 +86,43 @@ namespace MultiplayerSample
         RegisterMultiplayerComponents();
 
         AZ::Interface<Multiplayer::IMultiplayerSpawner>::Register(this);
-        m_playerSpawner = AZStd::make_unique<RoundRobinSpawner>();
+        m_playerSpawner = AZStd::make_unique<OccupancyAwareSpawner>();
         AZ::Interface<MultiplayerSample::IPlayerSpawner>::Register(m_playerSpawner.get());
+        m_animationUpdateScheduler = AZStd::make_unique<AnimationUpdateScheduler>();
+        AZ::Interface<MultiplayerSample::AnimationUpdateScheduler>::Register(m_animationUpdateScheduler.get());
+        m_prioritizedReplicationManager = AZStd::make_unique<PrioritizedReplicationManager>();
+        AZ::Interface<MultiplayerSample::PrioritizedReplicationManager>::Register(m_prioritizedReplicationManager.get());
+        m_characterSpatialHash = AZStd::make_unique<CharacterSpatialHash>();
+        AZ::Interface<MultiplayerSample::CharacterSpatialHash>::Register(m_characterSpatialHash.get());
+        m_aiSystem = AZStd::make_unique<AiSystem>();
+        AZ::Interface<MultiplayerSample::AiSystem>::Register(m_aiSystem.get());
+        m_inputRecorder = AZStd::make_unique<InputRecorder>();
+        AZ::Interface<MultiplayerSample::InputRecorder>::Register(m_inputRecorder.get());
+        m_loadGenerator = AZStd::make_unique<LoadGenerator>();
+        AZ::Interface<MultiplayerSample::LoadGenerator>::Register(m_loadGenerator.get());
+        m_perfTelemetry = AZStd::make_unique<PerfTelemetry>();
+        AZ::Interface<MultiplayerSample::PerfTelemetry>::Register(m_perfTelemetry.get());
+        m_randomImpulseScheduler = AZStd::make_unique<RandomImpulseScheduler>();
+        AZ::Interface<MultiplayerSample::RandomImpulseScheduler>::Register(m_randomImpulseScheduler.get());
+        m_randomTranslateMover = AZStd::make_unique<RandomTranslateMover>();
+        AZ::Interface<MultiplayerSample::RandomTranslateMover>::Register(m_randomTranslateMover.get());
     }
 
     void MultiplayerSampleSystemComponent::Deactivate()
     {
+        AZ::Interface<MultiplayerSample::RandomTranslateMover>::Unregister(m_randomTranslateMover.get());
+        AZ::Interface<MultiplayerSample::RandomImpulseScheduler>::Unregister(m_randomImpulseScheduler.get());
+
+        // Flushes any capture in progress and logs its summary
+        m_perfTelemetry->StopCapture();
+        AZ::Interface<MultiplayerSample::PerfTelemetry>::Unregister(m_perfTelemetry.get());
+        AZ::Interface<MultiplayerSample::LoadGenerator>::Unregister(m_loadGenerator.get());
+        m_inputRecorder->StopRecording();
+        AZ::Interface<MultiplayerSample::InputRecorder>::Unregister(m_inputRecorder.get());
+        AZ::Interface<MultiplayerSample::AiSystem>::Unregister(m_aiSystem.get());
+        AZ::Interface<MultiplayerSample::CharacterSpatialHash>::Unregister(m_characterSpatialHash.get());
+        AZ::Interface<MultiplayerSample::PrioritizedReplicationManager>::Unregister(m_prioritizedReplicationManager.get());
+        AZ::Interface<MultiplayerSample::AnimationUpdateScheduler>::Unregister(m_animationUpdateScheduler.get());
         AZ::Interface<MultiplayerSample::IPlayerSpawner>::Unregister(m_playerSpawner.get());
         AZ::Interface<Multiplayer::IMultiplayerSpawner>::Unregister(this);
         AZ::TickBus::Handler::BusDisconnect();
@@ -99,7 +130,32 @@ namespace MultiplayerSample
 
     void MultiplayerSampleSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        ;
+        // Re-bucket characters that moved since the last frame so proximity queries made during the AI tick see current positions
+        m_characterSpatialHash->Update();
+
+        // Cache how crowded each spawn point is, player joins until the next tick only compare the cached scores
+        m_playerSpawner->Update();
+
+        // Produce the synthetic inputs that AI characters will submit on their next input frame
+        m_aiSystem->Tick(deltaTime);
+
+        // Network entities have already been through pre-render for this frame, so every character has queued its update.
+        // Run them as one batch before rendering reads the poses, then prepare the scheduler for the next frame.
+        {
+            ScopedPerfSection animationSection(PerfSection::Animation);
+            m_animationUpdateScheduler->UpdateActors();
+        }
+        m_animationUpdateScheduler->BeginFrame();
+
+        m_randomImpulseScheduler->Tick();
+
+        m_randomTranslateMover->Tick(deltaTime);
+
+        // Connections the Multiplayer gem finished setting up this frame switch to the prioritized replication window
+        m_prioritizedReplicationManager->Tick();
+
+        m_loadGenerator->Tick(deltaTime);
+        m_perfTelemetry->Tick(deltaTime);
     }
 
     int MultiplayerSampleSystemComponent::GetTickOrder()
@@ -12,6 +12,15 @@
 
 #include <Multiplayer/IMultiplayerSpawner.h>
 #include <Source/Spawners/IPlayerSpawner.h>
+#include <Source/Ai/AiSystem.h>
+#include <Source/Ai/InputRecording.h>
+#include <Source/Animation/AnimationUpdateScheduler.h>
+#include <Source/Components/PerfTest/RandomImpulseScheduler.h>
+#include <Source/Components/PerfTest/RandomTranslateMover.h>
+#include <Source/LoadTest/LoadGenerator.h>
+#include <Source/LoadTest/PerfTelemetry.h>
+#include <Source/Replication/PrioritizedReplicationManager.h>
+#include <Source/Spatial/CharacterSpatialHash.h>
 
 namespace AzFramework
 {
@@ -65,5 +74,14 @@ namespace MultiplayerSample
         ////////////////////////////////////////////////////////////////////////
 
         AZStd::unique_ptr<MultiplayerSample::IPlayerSpawner> m_playerSpawner;
+        AZStd::unique_ptr<MultiplayerSample::AnimationUpdateScheduler> m_animationUpdateScheduler;
+        AZStd::unique_ptr<MultiplayerSample::CharacterSpatialHash> m_characterSpatialHash;
+        AZStd::unique_ptr<MultiplayerSample::AiSystem> m_aiSystem;
+        AZStd::unique_ptr<MultiplayerSample::InputRecorder> m_inputRecorder;
+        AZStd::unique_ptr<MultiplayerSample::LoadGenerator> m_loadGenerator;
+        AZStd::unique_ptr<MultiplayerSample::PerfTelemetry> m_perfTelemetry;
+        AZStd::unique_ptr<MultiplayerSample::RandomImpulseScheduler> m_randomImpulseScheduler;
+        AZStd::unique_ptr<MultiplayerSample::RandomTranslateMover> m_randomTranslateMover;
+        AZStd::unique_ptr<MultiplayerSample::PrioritizedReplicationManager> m_prioritizedReplicationManager;
     };
 }
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Replication/PrioritizedReplicationManager.h>
+#include <Source/Replication/PrioritizedReplicationWindow.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzNetworking/ConnectionLayer/IConnectionSet.h>
+#include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzNetworking/Framework/INetworking.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/ConnectionData/IConnectionData.h>
+#include <Multiplayer/MultiplayerConstants.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(bool, sv_PrioritizedReplication, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If enabled, player connections replicate through a window prioritized by distance and view direction under a per-tick byte budget");
+
+    static void mps_PrioritizedReplicationStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (PrioritizedReplicationManager* manager = AZ::Interface<PrioritizedReplicationManager>::Get())
+        {
+            manager->LogStats();
+        }
+    }
+    AZ_CONSOLEFREEFUNC(mps_PrioritizedReplicationStats, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Logs the updates and bytes sent to each connection with a prioritized replication window since the last call");
+
+    void PrioritizedReplicationManager::AddPlayer(const Multiplayer::NetworkEntityHandle& playerEntity)
+    {
+        m_players.push_back(playerEntity);
+    }
+
+    void PrioritizedReplicationManager::RemovePlayer(Multiplayer::NetEntityId netEntityId)
+    {
+        AZStd::erase_if(m_players, [netEntityId](const Multiplayer::NetworkEntityHandle& player)
+        {
+            return player.GetNetEntityId() == netEntityId;
+        });
+    }
+
+    void PrioritizedReplicationManager::Tick()
+    {
+#if AZ_TRAIT_SERVER
+        if (!sv_PrioritizedReplication || m_players.empty())
+        {
+            return;
+        }
+
+        AzNetworking::INetworkInterface* networkInterface =
+            AZ::Interface<AzNetworking::INetworking>::Get()->RetrieveNetworkInterface(AZ::Name(Multiplayer::MpNetworkInterfaceName));
+        if (networkInterface == nullptr)
+        {
+            return;
+        }
+
+        for (const Multiplayer::NetworkEntityHandle& player : m_players)
+        {
+            const Multiplayer::NetBindComponent* netBindComponent = player.GetNetBindComponent();
+            if (netBindComponent == nullptr)
+            {
+                continue;
+            }
+
+            AzNetworking::IConnection* connection = networkInterface->GetConnectionSet().GetConnection(netBindComponent->GetOwningConnectionId());
+            Multiplayer::IConnectionData* connectionData =
+                (connection != nullptr) ? reinterpret_cast<Multiplayer::IConnectionData*>(connection->GetUserData()) : nullptr;
+            if ((connectionData == nullptr) || (connectionData->GetType() != Multiplayer::ConnectionDataType::ServerToClient))
+            {
+                continue;
+            }
+
+            // Wait for the Multiplayer gem to install its default window, it does so once it has handed the character to the connection
+            Multiplayer::EntityReplicationManager& replicationManager = connectionData->GetReplicationManager();
+            const Multiplayer::IReplicationWindow* currentWindow = replicationManager.GetReplicationWindow();
+            const bool hasPrioritizedWindow = AZStd::any_of(m_windows.begin(), m_windows.end(),
+                [currentWindow](const PrioritizedReplicationWindow* window) { return window == currentWindow; });
+            if ((currentWindow != nullptr) && !hasPrioritizedWindow)
+            {
+                replicationManager.SetReplicationWindow(AZStd::make_unique<PrioritizedReplicationWindow>(player, connection));
+            }
+        }
+#endif
+    }
+
+    void PrioritizedReplicationManager::LogStats()
+    {
+        for (PrioritizedReplicationWindow* window : m_windows)
+        {
+            window->LogStats();
+        }
+    }
+
+    void PrioritizedReplicationManager::OnWindowCreated(PrioritizedReplicationWindow& window)
+    {
+        m_windows.push_back(&window);
+    }
+
+    void PrioritizedReplicationManager::OnWindowDestroyed(PrioritizedReplicationWindow& window)
+    {
+        AZStd::erase(m_windows, &window);
+    }
+}
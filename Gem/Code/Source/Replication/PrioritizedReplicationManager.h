@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+
+namespace MultiplayerSample
+{
+    class PrioritizedReplicationWindow;
+
+    //! @class PrioritizedReplicationManager
+    //! @brief Installs a PrioritizedReplicationWindow on the replication manager of every player connection.
+    //!
+    //! The Multiplayer gem gives each connection its default window once the connection's character is spawned.
+    //! Characters driven by a connection are registered here by their movement controllers, and every tick the
+    //! connection owning each registered character gets a prioritized window if it doesn't already have one.
+    class PrioritizedReplicationManager
+    {
+    public:
+        AZ_RTTI(PrioritizedReplicationManager, "{2F8C5A71-D4E9-4B36-A1C7-9E0D3B6F8524}");
+        virtual ~PrioritizedReplicationManager() = default;
+
+        //! Adds the character of a connected player, whose connection gets a prioritized window.
+        void AddPlayer(const Multiplayer::NetworkEntityHandle& playerEntity);
+        void RemovePlayer(Multiplayer::NetEntityId netEntityId);
+
+        //! Installs prioritized windows on the connections of registered players that don't have one yet.
+        //! Called once per frame by the MultiplayerSampleSystemComponent, does nothing unless sv_PrioritizedReplication is set.
+        void Tick();
+
+        //! Logs the replication to every connection with a prioritized window since the last call.
+        void LogStats();
+
+        //! Windows report their lifetime so the manager can tell which connections already have one.
+        //! @{
+        void OnWindowCreated(PrioritizedReplicationWindow& window);
+        void OnWindowDestroyed(PrioritizedReplicationWindow& window);
+        //! @}
+
+    private:
+        AZStd::vector<Multiplayer::NetworkEntityHandle> m_players;
+        AZStd::vector<PrioritizedReplicationWindow*> m_windows;
+    };
+}
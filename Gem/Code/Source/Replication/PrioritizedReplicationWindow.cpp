@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Replication/PrioritizedReplicationWindow.h>
+#include <Source/Replication/PrioritizedReplicationManager.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/std/limits.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkEntity/IFilterEntityManager.h>
+#include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(float, sv_PrioritizedWindowRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Entities within this distance of a connection's character are replicated to the connection");
+    AZ_CVAR(AZ::TimeMs, sv_PrioritizedWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "How often each connection's relevant entities and their priorities are refreshed");
+    AZ_CVAR(float, sv_PrioritizedWindowViewHalfAngle, 70.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Half-angle in degrees of the cone in front of a connection's character that counts as in view");
+    AZ_CVAR(float, sv_PrioritizedWindowOffscreenScale, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "Priority multiplier of entities outside of the view cone of a connection's character");
+    AZ_CVAR(uint32_t, sv_PrioritizedWindowBudgetBytes, 8192, nullptr, AZ::ConsoleFunctorFlags::Null, "Bytes of proxy entity updates each connection may be sent per tick, 0 for unlimited");
+
+    //! Update size assumed until the first updates to a connection have been measured
+    constexpr float InitialUpdateBytesEstimate = 64.0f;
+    //! Weight of each measured update in the running average of update sizes
+    constexpr float UpdateSizeSmoothing = 0.05f;
+
+    PrioritizedReplicationWindow::PrioritizedReplicationWindow(Multiplayer::NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection)
+        : m_controlledEntity(controlledEntity)
+        , m_connection(connection)
+        , m_updateWindowEvent([this]() { UpdateWindow(); }, AZ::Name("PrioritizedReplicationWindow update"))
+        , m_averageUpdateBytes(InitialUpdateBytesEstimate)
+    {
+        m_updateWindowEvent.Enqueue(sv_PrioritizedWindowUpdateMs, true);
+        UpdateWindow();
+
+        if (PrioritizedReplicationManager* manager = AZ::Interface<PrioritizedReplicationManager>::Get())
+        {
+            manager->OnWindowCreated(*this);
+        }
+    }
+
+    PrioritizedReplicationWindow::~PrioritizedReplicationWindow()
+    {
+        if (PrioritizedReplicationManager* manager = AZ::Interface<PrioritizedReplicationManager>::Get())
+        {
+            manager->OnWindowDestroyed(*this);
+        }
+    }
+
+    bool PrioritizedReplicationWindow::ReplicationSetUpdateReady()
+    {
+        // Nothing is replicated until the connection has a character to prioritize around
+        return m_controlledEntity.Exists();
+    }
+
+    const Multiplayer::ReplicationSet& PrioritizedReplicationWindow::GetReplicationSet() const
+    {
+        return m_replicationSet;
+    }
+
+    uint32_t PrioritizedReplicationWindow::GetMaxProxyEntityReplicatorSendCount() const
+    {
+        return m_maxProxySendCount;
+    }
+
+    bool PrioritizedReplicationWindow::IsInWindow(
+        [[maybe_unused]] const Multiplayer::ConstNetworkEntityHandle& entityHandle, Multiplayer::NetEntityRole& outNetworkRole) const
+    {
+        // Only used for server to server migration, which never goes through a client window
+        AZ_Assert(false, "IsInWindow should not be called on a server to client replication window");
+        outNetworkRole = Multiplayer::NetEntityRole::InvalidRole;
+        return false;
+    }
+
+    bool PrioritizedReplicationWindow::AddEntity(AZ::Entity* entity)
+    {
+        AZ::Entity* controlledEntity = m_controlledEntity.GetEntity();
+        if ((entity == nullptr) || (controlledEntity == nullptr))
+        {
+            return false;
+        }
+
+        const AZ::Transform viewerTm = controlledEntity->GetTransform()->GetWorldTM();
+        const AZ::Vector3 entityPosition = entity->GetTransform()->GetWorldTranslation();
+        const float radius = sv_PrioritizedWindowRadius;
+        if (viewerTm.GetTranslation().GetDistanceSq(entityPosition) > radius * radius)
+        {
+            return false;
+        }
+
+        const Multiplayer::NetBindComponent* netBindComponent = entity->FindComponent<Multiplayer::NetBindComponent>();
+        if (netBindComponent == nullptr)
+        {
+            return false;
+        }
+
+        const float priority = GetPriority(viewerTm.GetTranslation(), viewerTm.GetBasisY().GetNormalizedSafe(), entityPosition);
+        AddEntityToReplicationSet(Multiplayer::GetNetworkEntityTracker()->Get(netBindComponent->GetNetEntityId()), priority);
+        return true;
+    }
+
+    void PrioritizedReplicationWindow::RemoveEntity(AZ::Entity* entity)
+    {
+        const Multiplayer::NetBindComponent* netBindComponent = (entity != nullptr) ? entity->FindComponent<Multiplayer::NetBindComponent>() : nullptr;
+        if (netBindComponent != nullptr)
+        {
+            m_replicationSet.erase(Multiplayer::GetNetworkEntityTracker()->Get(netBindComponent->GetNetEntityId()));
+        }
+    }
+
+    void PrioritizedReplicationWindow::UpdateWindow()
+    {
+        m_replicationSet.clear();
+        UpdateMaxProxySendCount();
+
+        Multiplayer::NetBindComponent* controlledNetBind = m_controlledEntity.GetNetBindComponent();
+        if ((controlledNetBind == nullptr) || !controlledNetBind->HasController())
+        {
+            // The connection lost control of its character, nothing to prioritize around until it gets a new one
+            return;
+        }
+
+        const AZ::Transform viewerTm = m_controlledEntity.GetEntity()->GetTransform()->GetWorldTM();
+        const AZ::Vector3 viewerPosition = viewerTm.GetTranslation();
+        const AZ::Vector3 viewerForward = viewerTm.GetBasisY().GetNormalizedSafe();
+
+        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
+        const AZ::Sphere awarenessSphere(viewerPosition, sv_PrioritizedWindowRadius);
+        AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere,
+            [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+            {
+                if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                {
+                    gatheredEntries.push_back(visEntry);
+                }
+            }
+        });
+
+        Multiplayer::NetworkEntityTracker* networkEntityTracker = Multiplayer::GetNetworkEntityTracker();
+        Multiplayer::IFilterEntityManager* filterEntityManager = AZ::Interface<Multiplayer::IFilterEntityManager>::Get();
+        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        {
+            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
+            {
+                continue;
+            }
+
+            const Multiplayer::NetBindComponent* netBindComponent = entity->FindComponent<Multiplayer::NetBindComponent>();
+            if (netBindComponent == nullptr)
+            {
+                continue;
+            }
+
+            // Prioritize by the closest point of the entity's bounds, so large entities aren't starved by their center being far away
+            const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(viewerPosition - visEntry->m_boundingVolume.GetCenter());
+            const float priority = GetPriority(viewerPosition, viewerForward, closestPosition);
+            AddEntityToReplicationSet(networkEntityTracker->Get(netBindComponent->GetNetEntityId()), priority);
+        }
+
+        for (const Multiplayer::ConstNetworkEntityHandle& entityHandle : Multiplayer::GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet())
+        {
+            if (entityHandle.Exists())
+            {
+                AddEntityToReplicationSet(entityHandle, 1.0f);
+            }
+        }
+
+        // The connection's own entities are autonomous and always sent at full priority, so nothing may overwrite them after this point
+        m_replicationSet[m_controlledEntity] = { Multiplayer::NetEntityRole::Autonomous, 1.0f };
+        if (auto* hierarchyComponent = m_controlledEntity.FindComponent<Multiplayer::NetworkHierarchyRootComponent>())
+        {
+            for (AZ::Entity* hierarchicalEntity : hierarchyComponent->GetHierarchicalEntities())
+            {
+                const Multiplayer::NetBindComponent* netBindComponent = hierarchicalEntity->FindComponent<Multiplayer::NetBindComponent>();
+                if (netBindComponent != nullptr)
+                {
+                    m_replicationSet[networkEntityTracker->Get(netBindComponent->GetNetEntityId())] = { Multiplayer::NetEntityRole::Autonomous, 1.0f };
+                }
+            }
+        }
+    }
+
+    AzNetworking::PacketId PrioritizedReplicationWindow::SendEntityUpdateMessages(Multiplayer::NetworkEntityUpdateVector& entityUpdateVector)
+    {
+        const Multiplayer::HostFrameId frameId = Multiplayer::GetNetworkTime()->GetHostFrameId();
+        if (frameId != m_frameId)
+        {
+            m_frameId = frameId;
+            m_frameUpdateCount = 0;
+        }
+
+        // Measure the updates actually sent, so the send count keeps following the budget as the entities' contents change
+        for (const Multiplayer::NetworkEntityUpdateMessage& updateMessage : entityUpdateVector)
+        {
+            const uint32_t updateBytes = updateMessage.GetEstimatedSerializeSize();
+            m_averageUpdateBytes += (static_cast<float>(updateBytes) - m_averageUpdateBytes) * UpdateSizeSmoothing;
+            m_sentBytes += updateBytes;
+        }
+        UpdateMaxProxySendCount();
+
+        const bool wasBudgetLimited = (m_frameUpdateCount >= m_maxProxySendCount);
+        m_frameUpdateCount += aznumeric_cast<uint32_t>(entityUpdateVector.size());
+        m_sentUpdates += entityUpdateVector.size();
+        if (!wasBudgetLimited && (m_frameUpdateCount >= m_maxProxySendCount))
+        {
+            ++m_budgetLimitedFrames;
+        }
+
+        Multiplayer::MultiplayerPackets::EntityUpdates entityUpdatePacket;
+        entityUpdatePacket.SetHostTimeMs(Multiplayer::GetNetworkTime()->GetHostTimeMs());
+        entityUpdatePacket.SetHostFrameId(frameId);
+        entityUpdatePacket.SetEntityMessages(entityUpdateVector);
+        return m_connection->SendUnreliablePacket(entityUpdatePacket);
+    }
+
+    void PrioritizedReplicationWindow::SendEntityRpcs(Multiplayer::NetworkEntityRpcVector& entityRpcVector, bool reliable)
+    {
+        Multiplayer::MultiplayerPackets::EntityRpcs entityRpcsPacket;
+        entityRpcsPacket.SetEntityRpcs(entityRpcVector);
+        if (reliable)
+        {
+            m_connection->SendReliablePacket(entityRpcsPacket);
+        }
+        else
+        {
+            m_connection->SendUnreliablePacket(entityRpcsPacket);
+        }
+    }
+
+    void PrioritizedReplicationWindow::SendEntityResets([[maybe_unused]] const Multiplayer::NetEntityIdSet& resetIds)
+    {
+        // Resets are only requested by clients
+    }
+
+    void PrioritizedReplicationWindow::DebugDraw() const
+    {
+        AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+        AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+        AzFramework::DebugDisplayRequests* debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
+        AZ::Entity* controlledEntity = m_controlledEntity.GetEntity();
+        if ((debugDisplay == nullptr) || (controlledEntity == nullptr))
+        {
+            return;
+        }
+
+        debugDisplay->SetColor(AZ::Color(1.0f, 0.0f, 0.0f, 1.0f));
+        debugDisplay->DrawWireSphere(controlledEntity->GetTransform()->GetWorldTranslation(), sv_PrioritizedWindowRadius);
+    }
+
+    AzNetworking::ConnectionId PrioritizedReplicationWindow::GetConnectionId() const
+    {
+        return m_connection->GetConnectionId();
+    }
+
+    void PrioritizedReplicationWindow::LogStats()
+    {
+        AZLOG_INFO("Prioritized replication to connection %u: %zu relevant entities, %llu updates, %llu bytes, "
+            "%llu frames limited by the budget of %u updates",
+            static_cast<uint32_t>(GetConnectionId()), m_replicationSet.size(), static_cast<unsigned long long>(m_sentUpdates),
+            static_cast<unsigned long long>(m_sentBytes), static_cast<unsigned long long>(m_budgetLimitedFrames), m_maxProxySendCount);
+        m_sentUpdates = 0;
+        m_sentBytes = 0;
+        m_budgetLimitedFrames = 0;
+    }
+
+    float PrioritizedReplicationWindow::GetPriority(
+        const AZ::Vector3& viewerPosition, const AZ::Vector3& viewerForward, const AZ::Vector3& entityPosition) const
+    {
+        const AZ::Vector3 toEntity = entityPosition - viewerPosition;
+        const float distanceSq = toEntity.GetLengthSq();
+        const float distancePriority = (distanceSq > 1.0f) ? 1.0f / distanceSq : 1.0f;
+
+        const float minVisibleDot = AZ::Cos(AZ::DegToRad(sv_PrioritizedWindowViewHalfAngle));
+        const bool inView = viewerForward.Dot(toEntity) >= minVisibleDot * AZ::Sqrt(distanceSq);
+        return inView ? distancePriority : distancePriority * sv_PrioritizedWindowOffscreenScale;
+    }
+
+    void PrioritizedReplicationWindow::UpdateMaxProxySendCount()
+    {
+        const uint32_t budgetBytes = sv_PrioritizedWindowBudgetBytes;
+        m_maxProxySendCount = (budgetBytes > 0)
+            ? AZ::GetMax(1u, static_cast<uint32_t>(budgetBytes / m_averageUpdateBytes))
+            : AZStd::numeric_limits<uint32_t>::max();
+    }
+
+    void PrioritizedReplicationWindow::AddEntityToReplicationSet(const Multiplayer::ConstNetworkEntityHandle& entityHandle, float priority)
+    {
+        // An entity gathered more than once keeps its highest priority, and the connection's own entities stay autonomous
+        Multiplayer::EntityReplicationData& replicationData = m_replicationSet[entityHandle];
+        if (replicationData.m_netEntityRole != Multiplayer::NetEntityRole::Autonomous)
+        {
+            replicationData.m_netEntityRole = Multiplayer::NetEntityRole::Client;
+            replicationData.m_priority = AZ::GetMax(replicationData.m_priority, priority);
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+
+namespace MultiplayerSample
+{
+    //! @class PrioritizedReplicationWindow
+    //! @brief Server to client replication window that prioritizes entities by distance and view direction.
+    //!
+    //! Installed on a connection's replication manager by the PrioritizedReplicationManager in place of the default
+    //! window of the Multiplayer gem. Entities within the awareness radius of the connection's character are relevant,
+    //! and their priority falls with the squared distance to the character and is scaled down outside of its view cone.
+    //! The number of proxy updates the replication manager may send per tick is derived from a per-connection byte
+    //! budget and the measured size of the updates sent so far, so updates past the budget wait for a later tick.
+    class PrioritizedReplicationWindow
+        : public Multiplayer::IReplicationWindow
+    {
+    public:
+        PrioritizedReplicationWindow(Multiplayer::NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        ~PrioritizedReplicationWindow() override;
+
+        //! IReplicationWindow interface
+        //! @{
+        bool ReplicationSetUpdateReady() override;
+        const Multiplayer::ReplicationSet& GetReplicationSet() const override;
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override;
+        bool IsInWindow(const Multiplayer::ConstNetworkEntityHandle& entityHandle, Multiplayer::NetEntityRole& outNetworkRole) const override;
+        bool AddEntity(AZ::Entity* entity) override;
+        void RemoveEntity(AZ::Entity* entity) override;
+        void UpdateWindow() override;
+        AzNetworking::PacketId SendEntityUpdateMessages(Multiplayer::NetworkEntityUpdateVector& entityUpdateVector) override;
+        void SendEntityRpcs(Multiplayer::NetworkEntityRpcVector& entityRpcVector, bool reliable) override;
+        void SendEntityResets(const Multiplayer::NetEntityIdSet& resetIds) override;
+        void DebugDraw() const override;
+        //! @}
+
+        AzNetworking::ConnectionId GetConnectionId() const;
+
+        //! Logs the bytes and updates sent to this connection since the last call, and resets the counters.
+        void LogStats();
+
+    private:
+        //! Returns the priority of an entity for this connection, higher priorities are replicated first.
+        float GetPriority(const AZ::Vector3& viewerPosition, const AZ::Vector3& viewerForward, const AZ::Vector3& entityPosition) const;
+
+        //! Fits the proxy send count to the byte budget using the average size of the updates sent so far.
+        void UpdateMaxProxySendCount();
+
+        void AddEntityToReplicationSet(const Multiplayer::ConstNetworkEntityHandle& entityHandle, float priority);
+
+        Multiplayer::ReplicationSet m_replicationSet;
+        Multiplayer::NetworkEntityHandle m_controlledEntity;
+        AzNetworking::IConnection* m_connection = nullptr;
+
+        AZ::ScheduledEvent m_updateWindowEvent;
+
+        //! Proxy updates the replication manager may send per tick, recomputed from the budget as update sizes are measured
+        uint32_t m_maxProxySendCount = 0;
+        float m_averageUpdateBytes = 0.0f;
+
+        //! Host frame of the updates counted in m_frameUpdateCount
+        Multiplayer::HostFrameId m_frameId = Multiplayer::InvalidHostFrameId;
+        uint32_t m_frameUpdateCount = 0;
+
+        uint64_t m_sentBytes = 0;
+        uint64_t m_sentUpdates = 0;
+        uint64_t m_budgetLimitedFrames = 0;
+    };
+}
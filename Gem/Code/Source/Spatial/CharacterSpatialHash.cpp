@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Spatial/CharacterSpatialHash.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/limits.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(float, mps_SpatialHashCellSize, 10.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The size in meters of a character spatial hash cell, should be close to the typical query radius");
+
+    static bool IsInsideCone(const AZ::Vector3& offset, float distanceSq, const AZ::Vector3& direction, float cosHalfAngle)
+    {
+        return offset.Dot(direction) >= cosHalfAngle * AZ::Sqrt(distanceSq);
+    }
+
+    template <typename VisitorType>
+    void CharacterSpatialHash::VisitRadius(const AZ::Vector3& center, float radius, const VisitorType& visitor) const
+    {
+        const float radiusSq = radius * radius;
+        const int32_t minX = GetCellCoordinate(center.GetX() - radius);
+        const int32_t maxX = GetCellCoordinate(center.GetX() + radius);
+        const int32_t minY = GetCellCoordinate(center.GetY() - radius);
+        const int32_t maxY = GetCellCoordinate(center.GetY() + radius);
+
+        for (int32_t cellX = minX; cellX <= maxX; ++cellX)
+        {
+            for (int32_t cellY = minY; cellY <= maxY; ++cellY)
+            {
+                auto bucketIter = m_buckets.find(GetCellKey(cellX, cellY));
+                if (bucketIter == m_buckets.end())
+                {
+                    continue;
+                }
+
+                for (const BucketEntry& entry : bucketIter->second)
+                {
+                    const float distanceSq = entry.m_position.GetDistanceSq(center);
+                    if (distanceSq <= radiusSq)
+                    {
+                        visitor(entry, distanceSq);
+                    }
+                }
+            }
+        }
+    }
+
+    CharacterSpatialHash::CharacterSpatialHash()
+        : m_cellSize(AZ::GetMax(static_cast<float>(mps_SpatialHashCellSize), 1.0f))
+    {
+    }
+
+    void CharacterSpatialHash::AddCharacter(Multiplayer::NetEntityId netEntityId, AZ::TransformInterface& transform)
+    {
+        RemoveCharacter(netEntityId);
+
+        Character& character = m_characters[netEntityId];
+        character.m_transform = &transform;
+        character.m_transformChangedHandler = AZ::TransformChangedEvent::Handler(
+            [this, netEntityId]([[maybe_unused]] const AZ::Transform& localTm, [[maybe_unused]] const AZ::Transform& worldTm)
+            {
+                auto characterIter = m_characters.find(netEntityId);
+                if ((characterIter != m_characters.end()) && !characterIter->second.m_dirty)
+                {
+                    characterIter->second.m_dirty = true;
+                    m_dirtyCharacters.push_back(netEntityId);
+                }
+            });
+        transform.BindTransformChangedEventHandler(character.m_transformChangedHandler);
+
+        InsertIntoBucket(netEntityId, character, transform.GetWorldTranslation());
+    }
+
+    void CharacterSpatialHash::RemoveCharacter(Multiplayer::NetEntityId netEntityId)
+    {
+        auto characterIter = m_characters.find(netEntityId);
+        if (characterIter == m_characters.end())
+        {
+            return;
+        }
+
+        // Stale ids left in the dirty list are skipped by Update
+        RemoveFromBucket(characterIter->second);
+        m_characters.erase(characterIter);
+    }
+
+    void CharacterSpatialHash::Update()
+    {
+        if (!AZ::IsClose(m_cellSize, AZ::GetMax(static_cast<float>(mps_SpatialHashCellSize), 1.0f)))
+        {
+            Rebuild();
+            return;
+        }
+
+        for (Multiplayer::NetEntityId netEntityId : m_dirtyCharacters)
+        {
+            auto characterIter = m_characters.find(netEntityId);
+            if (characterIter == m_characters.end())
+            {
+                continue;
+            }
+
+            Character& character = characterIter->second;
+            character.m_dirty = false;
+
+            const AZ::Vector3 position = character.m_transform->GetWorldTranslation();
+            const CellKey cellKey = GetCellKey(position);
+            if (cellKey == character.m_cellKey)
+            {
+                m_buckets[cellKey][character.m_bucketIndex].m_position = position;
+            }
+            else
+            {
+                RemoveFromBucket(character);
+                InsertIntoBucket(netEntityId, character, position);
+            }
+        }
+        m_dirtyCharacters.clear();
+    }
+
+    bool CharacterSpatialHash::GetPosition(Multiplayer::NetEntityId netEntityId, AZ::Vector3& outPosition) const
+    {
+        auto characterIter = m_characters.find(netEntityId);
+        if (characterIter == m_characters.end())
+        {
+            return false;
+        }
+
+        const Character& character = characterIter->second;
+        outPosition = m_buckets.at(character.m_cellKey)[character.m_bucketIndex].m_position;
+        return true;
+    }
+
+    void CharacterSpatialHash::QueryRadius(const AZ::Vector3& center, float radius, AZStd::vector<Multiplayer::NetEntityId>& outResults) const
+    {
+        VisitRadius(center, radius, [&outResults](const BucketEntry& entry, [[maybe_unused]] float distanceSq)
+        {
+            outResults.push_back(entry.m_netEntityId);
+        });
+    }
+
+    void CharacterSpatialHash::QueryCone(const AZ::Vector3& origin, const AZ::Vector3& direction, float range, float halfAngle,
+        AZStd::vector<Multiplayer::NetEntityId>& outResults) const
+    {
+        const float cosHalfAngle = AZ::Cos(halfAngle);
+        VisitRadius(origin, range, [&](const BucketEntry& entry, float distanceSq)
+        {
+            if (IsInsideCone(entry.m_position - origin, distanceSq, direction, cosHalfAngle))
+            {
+                outResults.push_back(entry.m_netEntityId);
+            }
+        });
+    }
+
+    Multiplayer::NetEntityId CharacterSpatialHash::FindNearestInCone(const AZ::Vector3& origin, const AZ::Vector3& direction, float range,
+        float halfAngle, Multiplayer::NetEntityId excludedNetEntityId) const
+    {
+        const float cosHalfAngle = AZ::Cos(halfAngle);
+        Multiplayer::NetEntityId nearestNetEntityId = Multiplayer::InvalidNetEntityId;
+        float nearestDistanceSq = AZStd::numeric_limits<float>::max();
+        VisitRadius(origin, range, [&](const BucketEntry& entry, float distanceSq)
+        {
+            if ((entry.m_netEntityId == excludedNetEntityId) || (distanceSq >= nearestDistanceSq))
+            {
+                return;
+            }
+
+            if (IsInsideCone(entry.m_position - origin, distanceSq, direction, cosHalfAngle))
+            {
+                nearestNetEntityId = entry.m_netEntityId;
+                nearestDistanceSq = distanceSq;
+            }
+        });
+        return nearestNetEntityId;
+    }
+
+    CharacterSpatialHash::CellKey CharacterSpatialHash::GetCellKey(const AZ::Vector3& position) const
+    {
+        return GetCellKey(GetCellCoordinate(position.GetX()), GetCellCoordinate(position.GetY()));
+    }
+
+    CharacterSpatialHash::CellKey CharacterSpatialHash::GetCellKey(int32_t cellX, int32_t cellY) const
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+    }
+
+    int32_t CharacterSpatialHash::GetCellCoordinate(float value) const
+    {
+        return static_cast<int32_t>(AZStd::floor(value / m_cellSize));
+    }
+
+    void CharacterSpatialHash::InsertIntoBucket(Multiplayer::NetEntityId netEntityId, Character& character, const AZ::Vector3& position)
+    {
+        character.m_cellKey = GetCellKey(position);
+        Bucket& bucket = m_buckets[character.m_cellKey];
+        character.m_bucketIndex = bucket.size();
+        bucket.push_back({ netEntityId, position });
+    }
+
+    void CharacterSpatialHash::RemoveFromBucket(Character& character)
+    {
+        auto bucketIter = m_buckets.find(character.m_cellKey);
+        if (bucketIter == m_buckets.end())
+        {
+            return;
+        }
+
+        // Swap the last entry into the freed slot to keep the bucket contiguous
+        Bucket& bucket = bucketIter->second;
+        if (character.m_bucketIndex != bucket.size() - 1)
+        {
+            bucket[character.m_bucketIndex] = bucket.back();
+            auto movedIter = m_characters.find(bucket[character.m_bucketIndex].m_netEntityId);
+            if (movedIter != m_characters.end())
+            {
+                movedIter->second.m_bucketIndex = character.m_bucketIndex;
+            }
+        }
+        bucket.pop_back();
+
+        if (bucket.empty())
+        {
+            m_buckets.erase(bucketIter);
+        }
+    }
+
+    void CharacterSpatialHash::Rebuild()
+    {
+        m_cellSize = AZ::GetMax(static_cast<float>(mps_SpatialHashCellSize), 1.0f);
+        m_buckets.clear();
+        m_dirtyCharacters.clear();
+        for (auto& [netEntityId, character] : m_characters)
+        {
+            character.m_dirty = false;
+            InsertIntoBucket(netEntityId, character, character.m_transform->GetWorldTranslation());
+        }
+    }
+}
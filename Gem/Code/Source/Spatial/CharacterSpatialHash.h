@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace MultiplayerSample
+{
+    //! @class CharacterSpatialHash
+    //! @brief Uniform grid of networked character positions for cheap proximity queries.
+    //!
+    //! Characters are bucketed by their position on the XY plane. Each bucket stores the ids and positions of its
+    //! characters contiguously, so queries only touch the buckets overlapping the query bounds and never the entities
+    //! themselves. Transform changes only mark characters dirty, the buckets are brought up to date once per tick
+    //! by the MultiplayerSampleSystemComponent.
+    //!
+    //! Characters are registered by their movement controllers, so a server can query every character while a
+    //! client only sees the characters it controls.
+    class CharacterSpatialHash
+    {
+    public:
+        AZ_RTTI(CharacterSpatialHash, "{E4B81F27-9C3D-4A6E-8F15-2D7A0C96B3E1}");
+        CharacterSpatialHash();
+        virtual ~CharacterSpatialHash() = default;
+
+        void AddCharacter(Multiplayer::NetEntityId netEntityId, AZ::TransformInterface& transform);
+        void RemoveCharacter(Multiplayer::NetEntityId netEntityId);
+
+        //! Moves every character whose transform changed since the last update into its current bucket.
+        void Update();
+
+        //! Returns the position of a character as of the last update.
+        //! @return false if the character is not registered
+        bool GetPosition(Multiplayer::NetEntityId netEntityId, AZ::Vector3& outPosition) const;
+
+        //! Appends every character within radius of center to outResults.
+        void QueryRadius(const AZ::Vector3& center, float radius, AZStd::vector<Multiplayer::NetEntityId>& outResults) const;
+
+        //! Appends every character within range of origin and within halfAngle radians of direction to outResults.
+        //! @param direction the normalized cone axis
+        void QueryCone(const AZ::Vector3& origin, const AZ::Vector3& direction, float range, float halfAngle,
+            AZStd::vector<Multiplayer::NetEntityId>& outResults) const;
+
+        //! Returns the closest character inside the cone, ignoring the excluded character.
+        //! @return the closest character, or InvalidNetEntityId if the cone is empty
+        Multiplayer::NetEntityId FindNearestInCone(const AZ::Vector3& origin, const AZ::Vector3& direction, float range, float halfAngle,
+            Multiplayer::NetEntityId excludedNetEntityId) const;
+
+    private:
+        using CellKey = uint64_t;
+
+        struct BucketEntry
+        {
+            Multiplayer::NetEntityId m_netEntityId = Multiplayer::InvalidNetEntityId;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        };
+        using Bucket = AZStd::vector<BucketEntry>;
+
+        struct Character
+        {
+            AZ::TransformInterface* m_transform = nullptr;
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+            CellKey m_cellKey = 0;
+            size_t m_bucketIndex = 0;
+            bool m_dirty = false;
+        };
+
+        CellKey GetCellKey(const AZ::Vector3& position) const;
+        CellKey GetCellKey(int32_t cellX, int32_t cellY) const;
+        int32_t GetCellCoordinate(float value) const;
+
+        void InsertIntoBucket(Multiplayer::NetEntityId netEntityId, Character& character, const AZ::Vector3& position);
+        void RemoveFromBucket(Character& character);
+        void Rebuild();
+
+        //! Calls visitor for every bucket entry within radius of center.
+        template <typename VisitorType>
+        void VisitRadius(const AZ::Vector3& center, float radius, const VisitorType& visitor) const;
+
+        AZStd::unordered_map<CellKey, Bucket> m_buckets;
+        AZStd::unordered_map<Multiplayer::NetEntityId, Character> m_characters;
+        AZStd::vector<Multiplayer::NetEntityId> m_dirtyCharacters;
+        float m_cellSize = 10.0f;
+    };
+}
@@ -36,5 +36,8 @@ namespace MultiplayerSample
         virtual bool RegisterPlayerSpawner(NetworkPlayerSpawnerComponent* spawner) = 0;
         virtual AZStd::pair<Multiplayer::PrefabEntityId, AZ::Transform> GetNextPlayerSpawn() = 0;
         virtual bool UnregisterPlayerSpawner(NetworkPlayerSpawnerComponent* spawner) = 0;
+
+        //! Refreshes any per-tick state used to pick spawns, called once per tick by the MultiplayerSampleSystemComponent.
+        virtual void Update() {}
     };
 } // namespace MultiplayerSample
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Spawners/OccupancyAwareSpawner.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Source/Spatial/CharacterSpatialHash.h>
+
+namespace MultiplayerSample
+{
+    AZ_CVAR(bool, sv_SpawnOccupancyEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If enabled, players spawn at the spawn point with the fewest characters around it instead of in strict rotation");
+    AZ_CVAR(float, sv_SpawnBlockedRadius, 1.5f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "A spawn point with a character closer than this distance is occupied and only used when every spawn point is");
+    AZ_CVAR(float, sv_SpawnThreatRadius, 15.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Characters closer than this distance to a spawn point count against it when picking where a player spawns");
+
+    AZStd::pair<Multiplayer::PrefabEntityId, AZ::Transform> OccupancyAwareSpawner::GetNextPlayerSpawn()
+    {
+        if (!sv_SpawnOccupancyEnabled || m_spawnPoints.empty())
+        {
+            return RoundRobinSpawner::GetNextPlayerSpawn();
+        }
+
+        // Spawners registered since the last update have no occupancy yet and are treated as free
+        m_occupancy.resize(m_spawnPoints.size());
+
+        // Visit the points in round robin order so the first of equally scored points wins
+        const size_t spawnPointCount = m_spawnPoints.size();
+        const size_t firstIndex = (m_spawnIndex < spawnPointCount) ? m_spawnIndex : 0;
+        size_t bestIndex = firstIndex;
+        uint64_t bestScore = AZStd::numeric_limits<uint64_t>::max();
+        for (size_t offset = 0; offset < spawnPointCount; ++offset)
+        {
+            const size_t index = (firstIndex + offset) % spawnPointCount;
+            const Occupancy& occupancy = m_occupancy[index];
+            const uint64_t score = (occupancy.m_blocked ? (uint64_t{ 1 } << 32) : 0) + occupancy.m_nearbyCharacters;
+            if (score < bestScore)
+            {
+                bestScore = score;
+                bestIndex = index;
+            }
+        }
+
+        m_spawnIndex = static_cast<uint8_t>((bestIndex + 1 == spawnPointCount) ? 0 : bestIndex + 1);
+        m_occupancy[bestIndex].m_blocked = true;
+
+        SpawnPoint& spawnPoint = m_spawnPoints[bestIndex];
+        ResolvePendingSnap(spawnPoint);
+        return AZStd::make_pair(spawnPoint.m_prefabEntityId, spawnPoint.m_transform);
+    }
+
+    bool OccupancyAwareSpawner::UnregisterPlayerSpawner(NetworkPlayerSpawnerComponent* spawner)
+    {
+        // Keep the occupancy of the remaining spawn points aligned with them
+        auto spawnPointIter = AZStd::find_if(m_spawnPoints.begin(), m_spawnPoints.end(),
+            [spawner](const SpawnPoint& spawnPoint) { return spawnPoint.m_spawner == spawner; });
+        const size_t index = AZStd::distance(m_spawnPoints.begin(), spawnPointIter);
+        if (index < m_occupancy.size())
+        {
+            m_occupancy.erase(m_occupancy.begin() + index);
+        }
+
+        return RoundRobinSpawner::UnregisterPlayerSpawner(spawner);
+    }
+
+    void OccupancyAwareSpawner::Update()
+    {
+        // Only the server picks spawns
+        const Multiplayer::IMultiplayer* multiplayer = AZ::Interface<Multiplayer::IMultiplayer>::Get();
+        const bool isServer = (multiplayer != nullptr)
+            && ((multiplayer->GetAgentType() == Multiplayer::MultiplayerAgentType::DedicatedServer)
+                || (multiplayer->GetAgentType() == Multiplayer::MultiplayerAgentType::ClientServer));
+        if (!isServer || !sv_SpawnOccupancyEnabled)
+        {
+            return;
+        }
+
+        const CharacterSpatialHash* characters = AZ::Interface<CharacterSpatialHash>::Get();
+        const float blockedRadiusSq = sv_SpawnBlockedRadius * sv_SpawnBlockedRadius;
+
+        m_occupancy.resize(m_spawnPoints.size());
+        for (size_t index = 0; index < m_spawnPoints.size(); ++index)
+        {
+            const AZ::Vector3 position = m_spawnPoints[index].m_transform.GetTranslation();
+            m_queryResults.clear();
+            characters->QueryRadius(position, sv_SpawnThreatRadius, m_queryResults);
+
+            Occupancy& occupancy = m_occupancy[index];
+            occupancy.m_blocked = false;
+            occupancy.m_nearbyCharacters = static_cast<uint32_t>(m_queryResults.size());
+            for (const Multiplayer::NetEntityId netEntityId : m_queryResults)
+            {
+                AZ::Vector3 characterPosition;
+                if (characters->GetPosition(netEntityId, characterPosition) && (characterPosition.GetDistanceSq(position) <= blockedRadiusSq))
+                {
+                    occupancy.m_blocked = true;
+                    break;
+                }
+            }
+        }
+    }
+} // namespace MultiplayerSample
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/Spawners/RoundRobinSpawner.h>
+
+namespace MultiplayerSample
+{
+    //! @class OccupancyAwareSpawner
+    //! @brief Picks the player spawn point with the fewest characters around it.
+    //!
+    //! Once per tick, after the CharacterSpatialHash is updated, each spawn point caches whether a character is standing
+    //! on it and how many characters are close enough to threaten a newly spawned player. A join then scores the cached
+    //! occupancy of every spawn point, preferring free points with the fewest nearby characters, and breaks ties in
+    //! round robin order. The points handed out are treated as occupied until the next update, so players joining on
+    //! the same tick are spread across points.
+    class OccupancyAwareSpawner
+        : public RoundRobinSpawner
+    {
+    public:
+        AZ_RTTI(OccupancyAwareSpawner, "{D5A83C17-6B2E-4F94-8E0D-3C7B1A9F5E62}", RoundRobinSpawner);
+
+        ////////////////////////////////////////////////////////////////////////
+        // IPlayerSpawner overrides
+        AZStd::pair<Multiplayer::PrefabEntityId, AZ::Transform> GetNextPlayerSpawn() override;
+        bool UnregisterPlayerSpawner(NetworkPlayerSpawnerComponent* spawner) override;
+        void Update() override;
+        ////////////////////////////////////////////////////////////////////////
+
+    private:
+        struct Occupancy
+        {
+            bool m_blocked = false;
+            uint32_t m_nearbyCharacters = 0;
+        };
+
+        //! Cached occupancy of each spawn point, index-parallel to m_spawnPoints. Spawn points registered since the last
+        //! update have no entry yet, unregistering a spawn point erases its entry
+        AZStd::vector<Occupancy> m_occupancy;
+        AZStd::vector<Multiplayer::NetEntityId> m_queryResults;
+    };
+} // namespace MultiplayerSample
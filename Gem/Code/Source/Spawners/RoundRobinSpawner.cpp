@@ -6,53 +6,77 @@
  */
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzFramework/Physics/PhysicsScene.h>
 #include <Source/Components/NetworkPlayerSpawnerComponent.h>
 #include <Source/Spawners/RoundRobinSpawner.h>
 
 namespace MultiplayerSample
 {
+    AZ_CVAR(float, mps_SpawnGroundProbeHeight, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Height above a player spawner that the ground snapping ray starts from, lets spawners placed slightly below the ground still snap");
+    AZ_CVAR(float, mps_SpawnGroundProbeDistance, 100.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The furthest distance below a player spawner that the ground snapping ray looks for the ground");
+    AZ_CVAR(float, mps_SpawnGroundClearance, 0.05f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance kept between the ground and a snapped spawn position, so new characters don't start in contact with the ground");
+
     bool RoundRobinSpawner::RegisterPlayerSpawner(NetworkPlayerSpawnerComponent* spawner)
     {
-        if (AZStd::find(m_spawners.begin(), m_spawners.end(), spawner) == m_spawners.end())
+        auto spawnPointIter = AZStd::find_if(m_spawnPoints.begin(), m_spawnPoints.end(),
+            [spawner](const SpawnPoint& spawnPoint) { return spawnPoint.m_spawner == spawner; });
+        if (spawnPointIter != m_spawnPoints.end())
         {
-            m_spawners.push_back(spawner);
-            return true;
+            return false;
         }
 
-        return false;
+        SpawnPoint spawnPoint;
+        spawnPoint.m_spawner = spawner;
+        // NetworkEntityManager currently operates against/validates AssetId or Path, opt for Path via Hint
+        spawnPoint.m_prefabEntityId = Multiplayer::PrefabEntityId(AZ::Name(spawner->GetSpawnableAsset().GetHint().c_str()));
+        spawnPoint.m_transform = spawner->GetEntity()->GetTransform()->GetWorldTM();
+        if (spawner->GetSnapToGround())
+        {
+            // The ground may not be in the physics scene yet if it activates after the spawner
+            spawnPoint.m_snapPending = !SnapToGround(spawnPoint.m_transform);
+        }
+
+        m_spawnPoints.push_back(AZStd::move(spawnPoint));
+        return true;
     }
 
     AZStd::pair<Multiplayer::PrefabEntityId, AZ::Transform> RoundRobinSpawner::GetNextPlayerSpawn()
     {
-        if (m_spawners.empty())
+        if (m_spawnPoints.empty())
         {
             AZLOG_WARN("No active NetworkPlayerSpawnerComponents were found on player spawn request.")
             return AZStd::make_pair<Multiplayer::PrefabEntityId, AZ::Transform>(Multiplayer::PrefabEntityId(), AZ::Transform::CreateIdentity());
         }
 
-        if (m_spawnIndex >= m_spawners.size())
+        if (m_spawnIndex >= m_spawnPoints.size())
         {
             AZLOG_WARN("RoundRobinSpawner has an out-of-bounds spawner index. Resetting spawn index to 0. Did you forget to call UnregisterPlayerSpawner?")
             m_spawnIndex = 0;
         }
 
-        NetworkPlayerSpawnerComponent* spawner = m_spawners[m_spawnIndex];
-        m_spawnIndex = m_spawnIndex + 1 == m_spawners.size() ? 0 : m_spawnIndex + 1;
-        // NetworkEntityManager currently operates against/validates AssetId or Path, opt for Path via Hint
-        Multiplayer::PrefabEntityId prefabEntityId(AZ::Name(spawner->GetSpawnableAsset().GetHint().c_str()));
+        SpawnPoint& spawnPoint = m_spawnPoints[m_spawnIndex];
+        m_spawnIndex = m_spawnIndex + 1 == m_spawnPoints.size() ? 0 : m_spawnIndex + 1;
 
-        return AZStd::make_pair<Multiplayer::PrefabEntityId, AZ::Transform>(
-            prefabEntityId, spawner->GetEntity()->GetTransform()->GetWorldTM());
+        ResolvePendingSnap(spawnPoint);
+
+        return AZStd::make_pair(spawnPoint.m_prefabEntityId, spawnPoint.m_transform);
     }
 
     bool RoundRobinSpawner::UnregisterPlayerSpawner(NetworkPlayerSpawnerComponent* spawner)
     {
-        if (AZStd::find(m_spawners.begin(), m_spawners.end(), spawner))
+        auto spawnPointIter = AZStd::find_if(m_spawnPoints.begin(), m_spawnPoints.end(),
+            [spawner](const SpawnPoint& spawnPoint) { return spawnPoint.m_spawner == spawner; });
+        if (spawnPointIter != m_spawnPoints.end())
         {
-            m_spawners.erase(AZStd::remove(m_spawners.begin(), m_spawners.end(), spawner));
+            m_spawnPoints.erase(spawnPointIter);
 
             // A spawner was removed, reset the next spawnIndex if it's now out-of-bounds
-            if (m_spawnIndex >= m_spawners.size())
+            if (m_spawnIndex >= m_spawnPoints.size())
             {
                 m_spawnIndex = 0;
             }
@@ -62,4 +86,81 @@ namespace MultiplayerSample
 
         return false;
     }
+
+    void RoundRobinSpawner::ResolvePendingSnap(SpawnPoint& spawnPoint) const
+    {
+        if (!spawnPoint.m_snapPending)
+        {
+            return;
+        }
+
+        AZ::Transform snappedTransform = spawnPoint.m_spawner->GetEntity()->GetTransform()->GetWorldTM();
+        if (SnapToGround(snappedTransform))
+        {
+            spawnPoint.m_transform = snappedTransform;
+            spawnPoint.m_snapPending = false;
+        }
+        else if (!spawnPoint.m_snapWarned)
+        {
+            AZLOG_WARN("Player spawner %s found no ground to snap to, spawning at the spawner's position.",
+                spawnPoint.m_spawner->GetEntity()->GetName().c_str());
+            spawnPoint.m_snapWarned = true;
+        }
+    }
+
+    bool RoundRobinSpawner::SnapToGround(AZ::Transform& transform) const
+    {
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (sceneInterface == nullptr)
+        {
+            return false;
+        }
+
+        const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        if (sceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            return false;
+        }
+
+        // Only static geometry counts as ground, characters and other dynamic bodies standing on a spawner are ignored
+        const AZ::Vector3 spawnerPosition = transform.GetTranslation();
+        AzPhysics::RayCastRequest request;
+        request.m_start = spawnerPosition + AZ::Vector3::CreateAxisZ(mps_SpawnGroundProbeHeight);
+        request.m_direction = -AZ::Vector3::CreateAxisZ();
+        request.m_distance = mps_SpawnGroundProbeHeight + mps_SpawnGroundProbeDistance;
+        request.m_queryType = AzPhysics::SceneQuery::QueryType::Static;
+        request.m_reportMultipleHits = true;
+
+        const AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(sceneHandle, &request);
+
+        // The ray starts above the spawner so spawners placed slightly below the ground still snap, but the first hit
+        // may be an overhang above the spawner. Prefer the highest hit at or below the spawner, then the lowest above it.
+        const float spawnerHeight = spawnerPosition.GetZ();
+        const AZ::Vector3* groundBelow = nullptr;
+        const AZ::Vector3* groundAbove = nullptr;
+        for (const AzPhysics::SceneQueryHit& hit : result.m_hits)
+        {
+            const float hitHeight = hit.m_position.GetZ();
+            if (hitHeight <= spawnerHeight)
+            {
+                if ((groundBelow == nullptr) || (hitHeight > groundBelow->GetZ()))
+                {
+                    groundBelow = &hit.m_position;
+                }
+            }
+            else if ((groundAbove == nullptr) || (hitHeight < groundAbove->GetZ()))
+            {
+                groundAbove = &hit.m_position;
+            }
+        }
+
+        const AZ::Vector3* ground = (groundBelow != nullptr) ? groundBelow : groundAbove;
+        if (ground == nullptr)
+        {
+            return false;
+        }
+
+        transform.SetTranslation(*ground + AZ::Vector3::CreateAxisZ(mps_SpawnGroundClearance));
+        return true;
+    }
 } // namespace MultiplayerSample
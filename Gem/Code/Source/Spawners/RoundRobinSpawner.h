@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/Math/Transform.h>
 #include <Source/Spawners/IPlayerSpawner.h>
 
 namespace AzFramework
@@ -23,6 +24,12 @@ namespace Multiplayer
 
 namespace MultiplayerSample
 {
+    //! @class RoundRobinSpawner
+    //! @brief Hands out the registered player spawners in turn.
+    //!
+    //! The prefab id and spawn transform of each spawner are resolved once when it registers, snapping the transform
+    //! to the ground below when the spawner asks for it, so a player join only reads the next entry of an array.
+    //! Spawners are expected to stay where they are once active.
     class RoundRobinSpawner
         : public MultiplayerSample::IPlayerSpawner
     {
@@ -36,8 +43,27 @@ namespace MultiplayerSample
         bool UnregisterPlayerSpawner(NetworkPlayerSpawnerComponent* spawner) override;
         ////////////////////////////////////////////////////////////////////////
 
-    private:
-        AZStd::vector<NetworkPlayerSpawnerComponent*> m_spawners;
+    protected:
+        struct SpawnPoint
+        {
+            NetworkPlayerSpawnerComponent* m_spawner = nullptr;
+            Multiplayer::PrefabEntityId m_prefabEntityId;
+            AZ::Transform m_transform = AZ::Transform::CreateIdentity();
+            //! Set when the ground could not be found at registration, the snap is retried on every spawn until it succeeds
+            bool m_snapPending = false;
+            //! Set once a failed retry has been reported, so a spawner with no ground only warns on its first spawn
+            bool m_snapWarned = false;
+        };
+
+        //! Moves the translation of transform onto the highest static surface at or below it. A surface slightly above it,
+        //! within mps_SpawnGroundProbeHeight, is only used when there is none below, so overhangs above a spawner are ignored.
+        //! @return false if there is no static surface within the probe range
+        bool SnapToGround(AZ::Transform& transform) const;
+
+        //! Retries the ground snap of a spawn point that found no ground at registration.
+        void ResolvePendingSnap(SpawnPoint& spawnPoint) const;
+
+        AZStd::vector<SpawnPoint> m_spawnPoints;
         uint8_t m_spawnIndex = 0;
     };
 } // namespace MultiplayerSample
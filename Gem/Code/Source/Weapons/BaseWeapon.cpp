@@ -8,6 +8,7 @@
 #include <Source/Weapons/BaseWeapon.h>
 #include <Source/Weapons/TraceWeapon.h>
 #include <Source/Weapons/ProjectileWeapon.h>
+#include <Source/LoadTest/PerfTelemetry.h>
 #include <AzCore/Console/ILogger.h>
 
 namespace MultiplayerSample
@@ -124,6 +125,7 @@ namespace MultiplayerSample
 
     bool BaseWeapon::GatherEntities(const ActivateEvent& eventData, IntersectResults& outResults)
     {
+        ScopedPerfSection gatherSection(PerfSection::WeaponGathers);
         const bool result = MultiplayerSample::GatherEntities(m_weaponParams.m_gatherParams, eventData, m_gatheredNetEntityIds, outResults);
         if (gp_PauseOnWeaponGather && (outResults.size() > 0))
         {
@@ -134,6 +136,7 @@ namespace MultiplayerSample
 
     ShotResult BaseWeapon::GatherEntitiesMultisegment(float deltaTime, ActiveShot& inOutActiveShot, IntersectResults& outResults)
     {
+        ScopedPerfSection gatherSection(PerfSection::WeaponGathers);
         ShotResult result = MultiplayerSample::GatherEntitiesMultisegment(m_weaponParams.m_gatherParams, m_gatheredNetEntityIds, deltaTime, inOutActiveShot, outResults);
         if (gp_PauseOnWeaponGather && (outResults.size() > 0))
         {
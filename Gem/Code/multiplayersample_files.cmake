@@ -9,8 +9,18 @@ set(FILES
     Include/NetworkPrefabSpawnerInterface.h
 
     Source/AutoGen/RpcTesterComponent.AutoComponent.xml
+    Source/Ai/AiSystem.cpp
+    Source/Ai/AiSystem.h
+    Source/Ai/AiTypes.cpp
+    Source/Ai/AiTypes.h
+    Source/Ai/InputRecording.cpp
+    Source/Ai/InputRecording.h
+    Source/Animation/AnimationUpdateScheduler.cpp
+    Source/Animation/AnimationUpdateScheduler.h
     Source/Components/ExampleFilteredEntityComponent.h
     Source/Components/ExampleFilteredEntityComponent.cpp
+    Source/Components/SpatialInterestFilterComponent.h
+    Source/Components/SpatialInterestFilterComponent.cpp
     Source/Components/NetworkAiComponent.cpp
     Source/Components/NetworkAiComponent.h
     Source/Components/NetworkAnimationComponent.cpp
@@ -31,6 +41,14 @@ set(FILES
     Source/Components/PerfTest/NetworkRandomImpulseComponent.h
     Source/Components/PerfTest/NetworkTestSpawnerComponent.cpp
     Source/Components/PerfTest/NetworkTestSpawnerComponent.h
+    Source/Components/PerfTest/RandomImpulseScheduler.cpp
+    Source/Components/PerfTest/RandomImpulseScheduler.h
+    Source/Components/PerfTest/RandomTranslateMover.cpp
+    Source/Components/PerfTest/RandomTranslateMover.h
+    Source/Components/PerfTest/SpawnPointSampler.cpp
+    Source/Components/PerfTest/SpawnPointSampler.h
+    Source/Components/PerfTest/SpawnRateScheduler.cpp
+    Source/Components/PerfTest/SpawnRateScheduler.h
     Source/Components/PerfTest/NetworkRandomTranslateComponent.cpp
     Source/Components/PerfTest/NetworkRandomTranslateComponent.h
     Source/Components/NetworkStressTestComponent.cpp
@@ -39,7 +57,19 @@ set(FILES
     Source/Components/NetworkPlayerMovementComponent.h
     Source/Components/RpcTesterComponent.cpp
     Source/Components/RpcTesterComponent.h
+    Source/LoadTest/LoadGenerator.cpp
+    Source/LoadTest/LoadGenerator.h
+    Source/LoadTest/PerfTelemetry.cpp
+    Source/LoadTest/PerfTelemetry.h
+    Source/Replication/PrioritizedReplicationManager.cpp
+    Source/Replication/PrioritizedReplicationManager.h
+    Source/Replication/PrioritizedReplicationWindow.cpp
+    Source/Replication/PrioritizedReplicationWindow.h
+    Source/Spatial/CharacterSpatialHash.cpp
+    Source/Spatial/CharacterSpatialHash.h
     Source/Spawners/IPlayerSpawner.h
+    Source/Spawners/OccupancyAwareSpawner.h
+    Source/Spawners/OccupancyAwareSpawner.cpp
     Source/Spawners/RoundRobinSpawner.h
     Source/Spawners/RoundRobinSpawner.cpp
     Source/Weapons/BaseWeapon.cpp